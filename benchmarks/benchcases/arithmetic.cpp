@@ -0,0 +1,81 @@
+#include <functional>
+
+#include "common.h"
+#include "wide_uint.h"
+
+namespace bench {
+
+// the 256-bit buckets widened, so mul is the full 512-bit product
+template <>
+inline uint512_t convert<uint512_t>(const uint256_t & value) {
+    return value;
+}
+
+}
+
+namespace {
+
+template <typename T>
+void register_type(const std::string & type, const std::vector<int64_t> & bits) {
+    bench::register_binary<T>("add", type, bits, std::plus<>{});
+    bench::register_binary<T>("sub", type, bits, std::minus<>{});
+    bench::register_binary<T>("mul", type, bits, std::multiplies<>{});
+    bench::register_division<T>("div", type, bits, std::divides<>{});
+    bench::register_division<T>("mod", type, bits, std::modulus<>{});
+}
+
+const bool registered = [] {
+    register_type<uint256_t>("uint256_t", bench::widths);
+#if defined(__SIZEOF_INT128__)
+    register_type<bench::native128>("native128", bench::native_widths);
+#endif
+#if defined(UINT256_BENCHMARK_BOOST)
+    register_type<bench::boost256>("boost", bench::widths);
+#endif
+    register_type<uint512_t>("uint512_t", bench::widths);
+
+    bench::register_division<uint256_t>("divmod", "uint256_t", bench::widths, [](const uint256_t & a, const uint256_t & b) {
+        return uint256_t::divmod(a, b);
+    });
+    bench::register_division<uint256_t>("divmod_u64", "uint256_t", { 64 }, [](const uint256_t & a, const uint256_t & b) {
+        return uint256_t::divmod(a, (uint64_t)b);
+    });
+    // dividend and divisor of the same small width, the common case in practice
+    bench::register_binary<uint256_t>("div_narrow", "uint256_t", bench::native_widths, [](const uint256_t & a, const uint256_t & b) {
+        return a / (b >> 1);
+    });
+    bench::register_binary<uint256_t>("mod_narrow", "uint256_t", bench::native_widths, [](const uint256_t & a, const uint256_t & b) {
+        return a % (b >> 1);
+    });
+    bench::register_binary<uint256_t>("mul_wide", "uint256_t", bench::widths, [](const uint256_t & a, const uint256_t & b) {
+        return mul_wide(a, b);
+    });
+    // divisor above b keeps the quotient below a
+    bench::register_binary<uint256_t>("muldiv", "uint256_t", bench::widths, [](const uint256_t & a, const uint256_t & b) {
+        return muldiv(a, b, b | (uint256_1 << 255));
+    });
+    bench::register_unary<uint256_t>("negate", "uint256_t", bench::widths, [](const uint256_t & a) {
+        return -a;
+    });
+    bench::register_unary<uint256_t>("isqrt", "uint256_t", bench::widths, [](const uint256_t & a) {
+        return isqrt(a);
+    });
+    // the usual contract-style loop, Newton's iteration started from the value itself
+    bench::register_unary<uint256_t>("isqrt_babylonian", "uint256_t", bench::widths, [](const uint256_t & a) {
+        uint256_t z = a, y = (a >> 1) + 1;
+        while (y < z) {
+            z = y;
+            y = (a / y + y) >> 1;
+        }
+        return z;
+    });
+    bench::register_unary<uint256_t>("ipow", "uint256_t", bench::widths, [](const uint256_t & a) {
+        return ipow(a, 0x55).first;
+    });
+    bench::register_unary<uint256_t>("log10", "uint256_t", bench::widths, [](const uint256_t & a) {
+        return log10(a | 1);
+    });
+    return true;
+}();
+
+}
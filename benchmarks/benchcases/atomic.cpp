@@ -0,0 +1,65 @@
+#include <mutex>
+
+#include "common.h"
+
+#include "uint256_atomic.h"
+
+namespace {
+
+// one shared counter per benchmark, updated from every benchmark thread
+uint256_atomic atomic_counter;
+
+struct locked_counter {
+    std::mutex mutex;
+    uint256_t value;
+};
+
+locked_counter mutex_counter;
+
+const uint256_t step = (uint256_1 << 128) + 3;
+
+void atomic_load(benchmark::State & state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(atomic_counter.load());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void mutex_load(benchmark::State & state) {
+    for (auto _ : state) {
+        uint256_t value;
+        {
+            const std::lock_guard<std::mutex> lock(mutex_counter.mutex);
+            value = mutex_counter.value;
+        }
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void atomic_fetch_add(benchmark::State & state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(atomic_counter.fetch_add(step));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void mutex_fetch_add(benchmark::State & state) {
+    for (auto _ : state) {
+        uint256_t previous;
+        {
+            const std::lock_guard<std::mutex> lock(mutex_counter.mutex);
+            previous = mutex_counter.value;
+            mutex_counter.value += step;
+        }
+        benchmark::DoNotOptimize(previous);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+}
+
+BENCHMARK(atomic_load)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(mutex_load)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(atomic_fetch_add)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(mutex_fetch_add)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,60 @@
+#include <memory>
+
+#include "common.h"
+
+#include "uint256_batch.h"
+
+namespace {
+
+// per element throughput of one kernel table over operand_count elements
+template <typename Run>
+void run(benchmark::State & state, const uint256::batch_isa isa, Run kernel) {
+    if (!uint256::batch_isa_supported(isa)) {
+        state.SkipWithError("instruction set not supported");
+        return;
+    }
+    const uint256::detail::batch_kernels & k = uint256::detail::kernels_for(isa);
+    const std::vector<uint256_t> a = bench::operands((int)state.range(0), 1);
+    const std::vector<uint256_t> b = bench::operands((int)state.range(0), 2);
+    std::vector<uint256_t> out(bench::operand_count);
+    std::unique_ptr<bool[]> flags(new bool[bench::operand_count]);
+    for (auto _ : state) {
+        kernel(k, a.data(), b.data(), out.data(), flags.get());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * bench::operand_count);
+}
+
+const bool registered = [] {
+    const std::pair <uint256::batch_isa, const char *> isas[] = {
+        { uint256::batch_isa::scalar, "scalar" },
+        { uint256::batch_isa::avx2, "avx2" },
+        { uint256::batch_isa::avx512, "avx512" },
+    };
+    for (const auto & [isa, name] : isas) {
+        const auto add = [](const uint256::detail::batch_kernels & k, const uint256_t * a, const uint256_t * b, uint256_t * out, bool *) {
+            k.add(a, b, out, bench::operand_count);
+        };
+        const auto sub = [](const uint256::detail::batch_kernels & k, const uint256_t * a, const uint256_t * b, uint256_t * out, bool *) {
+            k.sub(a, b, out, bench::operand_count);
+        };
+        const auto less = [](const uint256::detail::batch_kernels & k, const uint256_t * a, const uint256_t * b, uint256_t *, bool * flags) {
+            k.less(a, b, flags, bench::operand_count);
+        };
+        const auto max = [](const uint256::detail::batch_kernels & k, const uint256_t * a, const uint256_t * b, uint256_t * out, bool *) {
+            k.max(a, b, out, bench::operand_count);
+        };
+        const auto sum = [](const uint256::detail::batch_kernels & k, const uint256_t * a, const uint256_t *, uint256_t * out, bool *) {
+            out[0] = k.sum(a, bench::operand_count).first;
+        };
+        const std::string suffix = std::string("/") + name;
+        benchmark::RegisterBenchmark(("batch_add" + suffix).c_str(), [isa = isa, add](benchmark::State & state) { run(state, isa, add); })->ArgName("bits")->Arg(256);
+        benchmark::RegisterBenchmark(("batch_sub" + suffix).c_str(), [isa = isa, sub](benchmark::State & state) { run(state, isa, sub); })->ArgName("bits")->Arg(256);
+        benchmark::RegisterBenchmark(("batch_less" + suffix).c_str(), [isa = isa, less](benchmark::State & state) { run(state, isa, less); })->ArgName("bits")->Arg(256);
+        benchmark::RegisterBenchmark(("batch_max" + suffix).c_str(), [isa = isa, max](benchmark::State & state) { run(state, isa, max); })->ArgName("bits")->Arg(256);
+        benchmark::RegisterBenchmark(("batch_sum" + suffix).c_str(), [isa = isa, sum](benchmark::State & state) { run(state, isa, sum); })->ArgName("bits")->Arg(256);
+    }
+    return true;
+}();
+
+}
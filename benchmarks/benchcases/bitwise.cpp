@@ -0,0 +1,45 @@
+#include <functional>
+
+#include "common.h"
+
+namespace {
+
+template <typename T>
+void register_type(const std::string & type, const std::vector<int64_t> & bits) {
+    bench::register_binary<T>("and", type, bits, std::bit_and<>{});
+    bench::register_binary<T>("or", type, bits, std::bit_or<>{});
+    bench::register_binary<T>("xor", type, bits, std::bit_xor<>{});
+    bench::register_unary<T>("not", type, bits, std::bit_not<>{});
+    bench::register_binary<T>("shl", type, bits, [](const T & a, const T & b) {
+        return a << (unsigned int)(b & 0x7f);
+    });
+    bench::register_binary<T>("shr", type, bits, [](const T & a, const T & b) {
+        return a >> (unsigned int)(b & 0x7f);
+    });
+}
+
+const bool registered = [] {
+    register_type<uint256_t>("uint256_t", bench::widths);
+#if defined(__SIZEOF_INT128__)
+    register_type<bench::native128>("native128", bench::native_widths);
+#endif
+#if defined(UINT256_BENCHMARK_BOOST)
+    register_type<bench::boost256>("boost", bench::widths);
+#endif
+
+    bench::register_unary<uint256_t>("shl_n", "uint256_t", bench::widths, [](const uint256_t & a) {
+        return a.shl<67>();
+    });
+    bench::register_unary<uint256_t>("bits", "uint256_t", bench::widths, [](const uint256_t & a) {
+        return a.bits();
+    });
+    bench::register_unary<uint256_t>("countl_zero", "uint256_t", bench::widths, [](const uint256_t & a) {
+        return countl_zero(a);
+    });
+    bench::register_unary<uint256_t>("popcount", "uint256_t", bench::widths, [](const uint256_t & a) {
+        return popcount(a);
+    });
+    return true;
+}();
+
+}
@@ -0,0 +1,130 @@
+#if !defined(__UINT256_T_BENCHMARK_COMMON__)
+#define __UINT256_T_BENCHMARK_COMMON__
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#if defined(UINT256_BENCHMARK_BOOST)
+#include <boost/multiprecision/cpp_int.hpp>
+#endif
+
+#include "uint256.h"
+
+namespace bench {
+
+// power of two so the operand index wraps with a mask
+inline constexpr std::size_t operand_count = 1024;
+
+// operand buckets: every value has exactly this many significant bits
+inline const std::vector<int64_t> widths = { 64, 128, 192, 256 };
+inline const std::vector<int64_t> native_widths = { 64, 128 };
+
+inline std::vector<uint256_t> operands(const int bits, const uint64_t seed) {
+    std::mt19937_64 gen(seed * 1000 + bits);
+    std::vector<uint256_t> out;
+    out.reserve(operand_count);
+    for (std::size_t i = 0; i < operand_count; i++) {
+        uint256_t value(gen(), gen(), gen(), gen());
+        value >>= (256 - bits);
+        value |= uint256_1 << (bits - 1);
+        out.push_back(value);
+    }
+    return out;
+}
+
+// same values in the baseline representations
+template <typename T>
+T convert(const uint256_t & value);
+
+template <>
+inline uint256_t convert<uint256_t>(const uint256_t & value) {
+    return value;
+}
+
+#if defined(__SIZEOF_INT128__)
+using native128 = unsigned __int128;
+
+template <>
+inline native128 convert<native128>(const uint256_t & value) {
+    return ((native128)value.lower().upper() << 64) | value.lower().lower();
+}
+#endif
+
+#if defined(UINT256_BENCHMARK_BOOST)
+using boost256 = boost::multiprecision::uint256_t;
+
+template <>
+inline boost256 convert<boost256>(const uint256_t & value) {
+    boost256 out = value.upper().upper();
+    out = (out << 64) | value.upper().lower();
+    out = (out << 64) | value.lower().upper();
+    out = (out << 64) | value.lower().lower();
+    return out;
+}
+#endif
+
+template <typename T>
+std::vector<T> operands_as(const int bits, const uint64_t seed) {
+    std::vector<T> out;
+    out.reserve(operand_count);
+    for (const uint256_t & value : operands(bits, seed)) {
+        out.push_back(convert<T>(value));
+    }
+    return out;
+}
+
+// name/type/bits, e.g. "mul/uint256_t/bits:192"
+template <typename T, typename Op>
+void register_binary(const std::string & name, const std::string & type, const std::vector<int64_t> & bits, Op op) {
+    benchmark::RegisterBenchmark((name + "/" + type).c_str(), [op](benchmark::State & state) {
+        const std::vector<T> a = operands_as<T>((int)state.range(0), 1);
+        const std::vector<T> b = operands_as<T>((int)state.range(0), 2);
+        std::size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(op(a[i], b[i]));
+            i = (i + 1) & (operand_count - 1);
+        }
+        state.SetItemsProcessed(state.iterations());
+    })->ArgName("bits")->ArgsProduct({ bits });
+}
+
+template <typename T, typename Op>
+void register_unary(const std::string & name, const std::string & type, const std::vector<int64_t> & bits, Op op) {
+    benchmark::RegisterBenchmark((name + "/" + type).c_str(), [op](benchmark::State & state) {
+        const std::vector<T> a = operands_as<T>((int)state.range(0), 1);
+        std::size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(op(a[i]));
+            i = (i + 1) & (operand_count - 1);
+        }
+        state.SetItemsProcessed(state.iterations());
+    })->ArgName("bits")->ArgsProduct({ bits });
+}
+
+// full width dividend, divisor bucketed by width
+template <typename T, typename Op>
+void register_division(const std::string & name, const std::string & type, const std::vector<int64_t> & bits, Op op) {
+    // the native baseline only holds 128 bits
+    const int dividend_bits = (sizeof(T) == 16) ? 128 : 256;
+    benchmark::RegisterBenchmark((name + "/" + type).c_str(), [op, dividend_bits](benchmark::State & state) {
+        const std::vector<T> a = operands_as<T>(dividend_bits, 1);
+        const std::vector<T> b = operands_as<T>((int)state.range(0), 2);
+        std::size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(op(a[i], b[i]));
+            i = (i + 1) & (operand_count - 1);
+        }
+        state.SetItemsProcessed(state.iterations());
+    })->ArgName("bits")->ArgsProduct({ bits });
+}
+
+}
+
+#endif
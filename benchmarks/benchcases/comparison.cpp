@@ -0,0 +1,29 @@
+#include <functional>
+
+#include "common.h"
+
+namespace {
+
+template <typename T>
+void register_type(const std::string & type, const std::vector<int64_t> & bits) {
+    bench::register_binary<T>("eq", type, bits, std::equal_to<>{});
+    bench::register_binary<T>("ne", type, bits, std::not_equal_to<>{});
+    bench::register_binary<T>("lt", type, bits, std::less<>{});
+    bench::register_binary<T>("le", type, bits, std::less_equal<>{});
+    bench::register_binary<T>("gt", type, bits, std::greater<>{});
+    bench::register_binary<T>("ge", type, bits, std::greater_equal<>{});
+}
+
+const bool registered = [] {
+    register_type<uint256_t>("uint256_t", bench::widths);
+#if defined(__SIZEOF_INT128__)
+    register_type<bench::native128>("native128", bench::native_widths);
+#endif
+#if defined(UINT256_BENCHMARK_BOOST)
+    register_type<bench::boost256>("boost", bench::widths);
+#endif
+    bench::register_unary<uint256_t>("hash", "uint256_t", { 256 }, std::hash<uint256_t>{});
+    return true;
+}();
+
+}
@@ -0,0 +1,97 @@
+#include <string>
+
+#include "common.h"
+
+#include "uint256_compact.h"
+
+#if defined(UINT256_BENCHMARK_FMT)
+#   include <fmt/format.h>
+#   include "uint256_format.h"
+#endif
+
+namespace {
+
+// the string forms are prepared outside the timed loop
+void parse(benchmark::State & state, const uint8_t base) {
+    std::vector<std::string> text;
+    for (const uint256_t & value : bench::operands((int)state.range(0), 1)) {
+        text.push_back(value.str(base));
+    }
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(uint256_t(text[i], base));
+        i = (i + 1) & (bench::operand_count - 1);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+#if defined(UINT256_BENCHMARK_BOOST)
+void parse_boost(benchmark::State & state) {
+    std::vector<std::string> text;
+    for (const uint256_t & value : bench::operands((int)state.range(0), 1)) {
+        text.push_back(value.str(10));
+    }
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bench::boost256(text[i]));
+        i = (i + 1) & (bench::operand_count - 1);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+#endif
+
+const bool registered = [] {
+    bench::register_unary<uint256_t>("str_dec", "uint256_t", bench::widths, [](const uint256_t & a) {
+        return a.str(10);
+    });
+    bench::register_unary<uint256_t>("str_hex", "uint256_t", bench::widths, [](const uint256_t & a) {
+        return a.str(16);
+    });
+    bench::register_unary<uint256_t>("to_chars_dec", "uint256_t", bench::widths, [](const uint256_t & a) {
+        char buf[78];
+        return to_chars(buf, buf + sizeof(buf), a).ptr - buf;
+    });
+#if defined(UINT256_BENCHMARK_FMT)
+    // a log line's worth of formatting into a reused buffer
+    bench::register_unary<uint256_t>("fmt_dec_grouped", "uint256_t", bench::widths, [](const uint256_t & a) {
+        char buf[128];
+        return fmt::format_to(buf, "{:>30,}", a) - buf;
+    });
+    bench::register_unary<uint256_t>("fmt_hex_padded", "uint256_t", bench::widths, [](const uint256_t & a) {
+        char buf[128];
+        return fmt::format_to(buf, "{:#066x}", a) - buf;
+    });
+#endif
+#if defined(UINT256_BENCHMARK_BOOST)
+    bench::register_unary<bench::boost256>("str_dec", "boost", bench::widths, [](const bench::boost256 & a) {
+        return a.str();
+    });
+#endif
+
+    benchmark::RegisterBenchmark("parse_dec/uint256_t", parse, (uint8_t)10)->ArgName("bits")->ArgsProduct({ bench::widths });
+    benchmark::RegisterBenchmark("parse_hex/uint256_t", parse, (uint8_t)16)->ArgName("bits")->ArgsProduct({ bench::widths });
+#if defined(UINT256_BENCHMARK_BOOST)
+    benchmark::RegisterBenchmark("parse_dec/boost", parse_boost)->ArgName("bits")->ArgsProduct({ bench::widths });
+#endif
+
+    bench::register_unary<uint256_t>("export_bits", "uint256_t", bench::widths, [](const uint256_t & a) {
+        return a.export_bits();
+    });
+    bench::register_unary<uint256_t>("export_bits_truncate", "uint256_t", bench::widths, [](const uint256_t & a) {
+        return a.export_bits_truncate();
+    });
+    bench::register_unary<uint256_t>("encode_leb128", "uint256_t", bench::widths, [](const uint256_t & a) {
+        std::byte buf[uint256::leb128_max_size];
+        return uint256::encode_leb128(buf, buf + sizeof(buf), a).ptr - buf;
+    });
+    bench::register_unary<uint256_t>("encode_rlp", "uint256_t", bench::widths, [](const uint256_t & a) {
+        std::byte buf[uint256::rlp_max_size];
+        return uint256::encode_rlp(buf, buf + sizeof(buf), a).ptr - buf;
+    });
+    bench::register_unary<uint256_t>("to_uint64", "uint256_t", bench::widths, [](const uint256_t & a) {
+        return (uint64_t)a;
+    });
+    return true;
+}();
+
+}
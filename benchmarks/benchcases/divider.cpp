@@ -0,0 +1,36 @@
+#include "common.h"
+
+#include "uint256_divider.h"
+
+namespace {
+
+// full width dividends over one fixed divisor of the given width, with and without a divider
+template <typename Op>
+void register_fixed(const std::string & name, Op op) {
+    benchmark::RegisterBenchmark((name + "/uint256_t").c_str(), [op](benchmark::State & state) {
+        const std::vector<uint256_t> a = bench::operands(256, 1);
+        const uint256_t d = bench::operands((int)state.range(0), 2)[0];
+        const uint256_divider divider(d);
+        std::size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(op(a[i], d, divider));
+            i = (i + 1) & (bench::operand_count - 1);
+        }
+        state.SetItemsProcessed(state.iterations());
+    })->ArgName("bits")->ArgsProduct({ bench::widths });
+}
+
+const bool registered = [] {
+    register_fixed("div_fixed", [](const uint256_t & a, const uint256_t & d, const uint256_divider &) {
+        return a / d;
+    });
+    register_fixed("div_divider", [](const uint256_t & a, const uint256_t &, const uint256_divider & divider) {
+        return a / divider;
+    });
+    register_fixed("mod_divider", [](const uint256_t & a, const uint256_t &, const uint256_divider & divider) {
+        return a % divider;
+    });
+    return true;
+}();
+
+}
@@ -0,0 +1,36 @@
+#include <string>
+
+#include "common.h"
+
+#include "uint256_export.h"
+
+namespace {
+
+// decimal text for a block of full width values, per value
+const bool registered = [] {
+    benchmark::RegisterBenchmark("export_str/uint256_t", [](benchmark::State & state) {
+        const std::vector<uint256_t> a = bench::operands(256, 1);
+        for (auto _ : state) {
+            std::size_t size = 0;
+            for (const uint256_t & x : a) {
+                size += x.str().size() + 1;
+            }
+            benchmark::DoNotOptimize(size);
+        }
+        state.SetItemsProcessed(state.iterations() * a.size());
+    });
+    benchmark::RegisterBenchmark("export_batch/uint256_t", [](benchmark::State & state) {
+        const std::vector<uint256_t> a = bench::operands(256, 1);
+        for (auto _ : state) {
+            std::size_t size = 0;
+            uint256::to_chars_batch(a, [&size](std::string_view s) {
+                size += s.size();
+            }, { .chunk_values = 256, .threads = (unsigned int)state.range(0) });
+            benchmark::DoNotOptimize(size);
+        }
+        state.SetItemsProcessed(state.iterations() * a.size());
+    })->ArgName("threads")->Arg(1)->Arg(0);
+    return true;
+}();
+
+}
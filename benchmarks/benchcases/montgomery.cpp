@@ -0,0 +1,34 @@
+#include "common.h"
+
+#include "uint256_montgomery.h"
+
+namespace {
+
+const uint256_t secp256k1_p = 0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_u256;
+
+const bool registered = [] {
+    static const montgomery_context<uint256_t> field(secp256k1_p);
+
+    bench::register_binary<uint256_t>("montgomery_mul", "uint256_t", { 256 }, [](const uint256_t & a, const uint256_t & b) {
+        return field.montgomery_mul(a % secp256k1_p, b % secp256k1_p);
+    });
+    bench::register_binary<uint256_t>("mulmod", "uint256_t", { 256 }, [](const uint256_t & a, const uint256_t & b) {
+        return field.mulmod(a, b);
+    });
+    bench::register_binary<uint256_t>("powmod", "uint256_t", { 64, 256 }, [](const uint256_t & a, const uint256_t & b) {
+        return field.powmod(a, b);
+    });
+    bench::register_unary<uint256_t>("inverse", "uint256_t", { 256 }, [](const uint256_t & a) {
+        return field.inverse(a);
+    });
+#if defined(UINT256_BENCHMARK_BOOST)
+    bench::register_binary<bench::boost256>("mulmod", "boost", { 256 }, [](const bench::boost256 & a, const bench::boost256 & b) {
+        using wide = boost::multiprecision::uint512_t;
+        static const wide p = wide(bench::convert<bench::boost256>(secp256k1_p));
+        return bench::boost256((wide(a) * wide(b)) % p);
+    });
+#endif
+    return true;
+}();
+
+}
@@ -0,0 +1,44 @@
+#include <algorithm>
+#include <random>
+
+#include "common.h"
+
+#include "uint256_sort.h"
+
+namespace {
+
+// full width random keys, like hashes; every run sorts a fresh copy
+template <typename Sort>
+void register_sort(const std::string & name, Sort sort) {
+    benchmark::RegisterBenchmark((name + "/uint256_t").c_str(), [sort](benchmark::State & state) {
+        std::mt19937_64 gen(1);
+        std::vector<uint256_t> keys((std::size_t)state.range(0));
+        for (uint256_t & key : keys) {
+            key = uint256_t(gen(), gen(), gen(), gen());
+        }
+        std::vector<uint256_t> work;
+        for (auto _ : state) {
+            state.PauseTiming();
+            work = keys;
+            state.ResumeTiming();
+            sort(work);
+            benchmark::DoNotOptimize(work.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    })->ArgName("keys")->Arg(1 << 12)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+}
+
+const bool registered = [] {
+    register_sort("std_sort", [](std::vector<uint256_t> & keys) {
+        std::sort(keys.begin(), keys.end());
+    });
+    register_sort("radix_sort", [](std::vector<uint256_t> & keys) {
+        uint256::sort(keys);
+    });
+    register_sort("parallel_sort", [](std::vector<uint256_t> & keys) {
+        uint256::parallel_sort(keys);
+    });
+    return true;
+}();
+
+}
@@ -39,13 +39,717 @@ to do a general rewrite of this class.
 
 #include "endianness.h"
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <compare>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <concepts>
 #include <ostream>
+#include <span>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <string_view>
+#include <vector>
+
+// Operation counters for profiling builds (see uint256_instrument.h); without UINT256_INSTRUMENT
+// the probes expand to nothing
+#if defined(UINT256_INSTRUMENT)
+#   include "uint256_instrument.h"
+#   define UINT256_PROBE(...) uint256::instrument::probe uint256_probe_(__VA_ARGS__)
+#   define UINT256_PROBE_OPERAND(bits) uint256_probe_.operand(bits)
+#else
+#   define UINT256_PROBE(...)
+#   define UINT256_PROBE_OPERAND(bits)
+#endif
+
+// Multiply kernel selection; the portable path in operator* is used when none of these are available
+#if defined(__BMI2__) && defined(__ADX__) && (defined(__x86_64__) || defined(_M_X64))
+#   include <immintrin.h>
+#   define UINT256_T_NATIVE_MUL
+#   define UINT256_T_MUL_MULX
+#elif defined(__SIZEOF_INT128__)
+#   define UINT256_T_NATIVE_MUL
+#   define UINT256_T_MUL_INT128
+#elif defined(_MSC_VER) && defined(_M_X64)
+#   include <intrin.h>
+#   define UINT256_T_NATIVE_MUL
+#   define UINT256_T_MUL_UMUL128
+#endif
+
+// Carry chains: adc/sbb on x86-64, adcs/sbcs on AArch64 through clang's builtins or __int128
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#   include <immintrin.h>
+#   define UINT256_T_ADD_ADDCARRY
+#elif defined(_MSC_VER) && defined(_M_X64)
+#   include <intrin.h>
+#   define UINT256_T_ADD_ADDCARRY
+#elif defined(__has_builtin)
+#   if __has_builtin(__builtin_addcll) && __has_builtin(__builtin_subcll)
+#       define UINT256_T_ADD_BUILTIN
+#   endif
+#endif
+#if !defined(UINT256_T_ADD_ADDCARRY) && !defined(UINT256_T_ADD_BUILTIN) && defined(__SIZEOF_INT128__)
+#   define UINT256_T_ADD_INT128
+#endif
+
+// Limb loops over a compile-time count are unrolled completely, also at -O2
+#if defined(__clang__)
+#   define UINT256_T_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__)
+#   define UINT256_T_UNROLL _Pragma("GCC unroll 32")
+#else
+#   define UINT256_T_UNROLL
+#endif
+
+// 128 by 64-bit division step
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#   define UINT256_T_DIV_DIVQ
+#elif defined(__SIZEOF_INT128__)
+#   define UINT256_T_DIV_INT128
+#elif defined(_MSC_VER) && defined(_M_X64) && (_MSC_VER >= 1920)
+#   include <intrin.h>
+#   define UINT256_T_DIV_UDIV128
+#endif
+
+// Limb kernels; intrinsics and inline assembly are bypassed during constant evaluation
+namespace uint256::detail {
+
+// returns the low 64 bits of a * b + c + d and stores the high 64 bits in hi (never overflows 128 bits)
+constexpr uint64_t mul_add_64(const uint64_t a, const uint64_t b, const uint64_t c, const uint64_t d, uint64_t & hi) {
+#if defined(UINT256_T_MUL_INT128)
+    const unsigned __int128 t = (unsigned __int128)a * b + c + d;
+    hi = (uint64_t)(t >> 64);
+    return (uint64_t)t;
+#else
+#if defined(UINT256_T_NATIVE_MUL)
+    if (!std::is_constant_evaluated()) {
+        unsigned long long h, l;
+#if defined(UINT256_T_MUL_MULX)
+        l = _mulx_u64(a, b, &h);
+        unsigned char cf = _addcarryx_u64(0, l, c, &l);
+        _addcarryx_u64(cf, h, 0, &h);
+        cf = _addcarryx_u64(0, l, d, &l);
+        _addcarryx_u64(cf, h, 0, &h);
+#else
+        l = _umul128(a, b, &h);
+        unsigned char cf = _addcarry_u64(0, l, c, &l);
+        _addcarry_u64(cf, h, 0, &h);
+        cf = _addcarry_u64(0, l, d, &l);
+        _addcarry_u64(cf, h, 0, &h);
+#endif
+        hi = h;
+        return l;
+    }
+#endif
+    const uint128_t t = uint128_t(a) * uint128_t(b) + uint128_t(c) + uint128_t(d);
+    hi = t.upper();
+    return t.lower();
+#endif
+}
+
+// returns a + b + carry_in and stores the carry out (0 or 1)
+constexpr uint64_t add_carry_64(const uint64_t a, const uint64_t b, const uint64_t carry_in, uint64_t & carry_out) {
+#if defined(UINT256_T_ADD_INT128)
+    const unsigned __int128 t = (unsigned __int128)a + b + carry_in;
+    carry_out = (uint64_t)(t >> 64);
+    return (uint64_t)t;
+#else
+    if (!std::is_constant_evaluated()) {
+#if defined(UINT256_T_ADD_ADDCARRY)
+        unsigned long long s;
+        carry_out = _addcarry_u64((unsigned char)carry_in, a, b, &s);
+        return s;
+#elif defined(UINT256_T_ADD_BUILTIN)
+        unsigned long long c;
+        const uint64_t s = __builtin_addcll(a, b, carry_in, &c);
+        carry_out = c;
+        return s;
+#endif
+    }
+    const uint64_t s = a + b;
+    const uint64_t t = s + carry_in;
+    carry_out = (s < a) | (t < s);
+    return t;
+#endif
+}
+
+// returns a - b - borrow_in and stores the borrow out (0 or 1)
+constexpr uint64_t sub_borrow_64(const uint64_t a, const uint64_t b, const uint64_t borrow_in, uint64_t & borrow_out) {
+#if defined(UINT256_T_ADD_INT128)
+    const unsigned __int128 t = (unsigned __int128)a - b - borrow_in;
+    borrow_out = (uint64_t)(t >> 64) & 1;
+    return (uint64_t)t;
+#else
+    if (!std::is_constant_evaluated()) {
+#if defined(UINT256_T_ADD_ADDCARRY)
+        unsigned long long d;
+        borrow_out = _subborrow_u64((unsigned char)borrow_in, a, b, &d);
+        return d;
+#elif defined(UINT256_T_ADD_BUILTIN)
+        unsigned long long c;
+        const uint64_t d = __builtin_subcll(a, b, borrow_in, &c);
+        borrow_out = c;
+        return d;
+#endif
+    }
+    const uint64_t d = a - b;
+    const uint64_t t = d - borrow_in;
+    borrow_out = (a < b) | (d < borrow_in);
+    return t;
+#endif
+}
+
+// returns (hi:lo) / d and stores the remainder in r; requires hi < d
+constexpr uint64_t div_128_64(const uint64_t hi, const uint64_t lo, const uint64_t d, uint64_t & r) {
+#if defined(UINT256_T_DIV_DIVQ)
+    if (!std::is_constant_evaluated()) {
+        uint64_t q;
+        __asm__("divq %[d]" : "=a"(q), "=d"(r) : [d] "rm"(d), "a"(lo), "d"(hi));
+        return q;
+    }
+#elif defined(UINT256_T_DIV_UDIV128)
+    if (!std::is_constant_evaluated()) {
+        unsigned long long rem;
+        const uint64_t q = _udiv128(hi, lo, d, &rem);
+        r = rem;
+        return q;
+    }
+#endif
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 n = ((unsigned __int128)hi << 64) | lo;
+    const uint64_t q = (uint64_t)(n / d);
+    r = lo - q * d;
+    return q;
+#else
+    // Hacker's Delight divlu: two 64 by 32-bit steps on the normalized divisor
+    const uint64_t b = 1ULL << 32;
+    const int s = std::countl_zero(d);
+    const uint64_t dn = d << s;
+    const uint64_t dh = dn >> 32, dl = dn & 0xffffffffULL;
+    const uint64_t un32 = s ? ((hi << s) | (lo >> (64 - s))) : hi;
+    const uint64_t un10 = lo << s;
+    const uint64_t un1 = un10 >> 32, un0 = un10 & 0xffffffffULL;
+
+    uint64_t q1 = un32 / dh, rhat = un32 - q1 * dh;
+    while ((q1 >= b) || (q1 * dl > ((rhat << 32) | un1))) {
+        q1--;
+        rhat += dh;
+        if (rhat >= b) {
+            break;
+        }
+    }
+
+    const uint64_t un21 = (un32 << 32) + un1 - q1 * dn;
+    uint64_t q0 = un21 / dh;
+    rhat = un21 - q0 * dh;
+    while ((q0 >= b) || (q0 * dl > ((rhat << 32) | un0))) {
+        q0--;
+        rhat += dh;
+        if (rhat >= b) {
+            break;
+        }
+    }
+
+    r = (((un21 << 32) + un0) - q0 * dn) >> s;
+    return (q1 << 32) | q0;
+#endif
+}
+
+// Division by an invariant 64-bit divisor (Moller and Granlund, "Improved division by invariant
+// integers"): a multiply and at most two corrections instead of a hardware division per limb
+struct reciprocal_64 {
+    uint64_t d;         // divisor shifted left until its top bit is set
+    uint64_t v;         // floor((2^128 - 1) / d) - 2^64
+    unsigned int shift;
+};
+
+constexpr reciprocal_64 make_reciprocal_64(const uint64_t d) {
+    const unsigned int s = std::countl_zero(d);
+    const uint64_t dn = d << s;
+    uint64_t r = 0;
+    return reciprocal_64{ dn, div_128_64(~dn, ~0ULL, dn, r), s };
+}
+
+// returns (hi:lo) / rec.d and stores the remainder in r; requires hi < rec.d
+constexpr uint64_t div_128_64_preinv(const uint64_t hi, const uint64_t lo, const reciprocal_64 & rec, uint64_t & r) {
+    uint64_t q1 = 0;
+    const uint64_t q0 = mul_add_64(rec.v, hi, lo, 0, q1);
+    q1 += hi + 1;
+    uint64_t rem = lo - q1 * rec.d;
+    if (rem > q0) {
+        q1--;
+        rem += rec.d;
+    }
+    if (rem >= rec.d) [[unlikely]] {
+        q1++;
+        rem -= rec.d;
+    }
+    r = rem;
+    return q1;
+}
+
+// x[0, n) /= the divisor of rec in place, returning the remainder
+constexpr uint64_t div_limbs_preinv(uint64_t * x, const int n, const reciprocal_64 & rec) {
+    uint64_t r = 0;
+    if (!rec.shift) {
+        for (int i = n - 1; i >= 0; i--) {
+            x[i] = div_128_64_preinv(r, x[i], rec, r);
+        }
+        return r;
+    }
+    // divide x * 2^shift by the normalized divisor; the quotient is unchanged
+    const unsigned int s = rec.shift;
+    r = x[n - 1] >> (64 - s);
+    for (int i = n - 1; i >= 0; i--) {
+        const uint64_t lo = (x[i] << s) | (i ? (x[i - 1] >> (64 - s)) : 0);
+        x[i] = div_128_64_preinv(r, lo, rec, r);
+    }
+    return r >> s;
+}
+
+// counts outside [0, 256) map to 256, which shifts everything out
+template <typename T>
+constexpr unsigned int shift_count(const T & rhs) {
+    if constexpr (std::is_signed<T>::value) {
+        if (rhs < 0) {
+            return 256;
+        }
+    }
+    return (static_cast<uint64_t>(rhs) < 256) ? static_cast<unsigned int>(rhs) : 256;
+}
+
+// Branchless 256-bit shifts on limbs (least significant first): the 128 and 64-bit
+// limb moves are selected with masks, then the remaining bits are funneled across limbs
+constexpr void shl_limbs(uint64_t (&x)[4], const unsigned int s) {
+    const uint64_t keep = -(uint64_t)(s < 256);
+    const uint64_t m128 = -(uint64_t)((s >> 7) & 1);
+    const uint64_t m64 = -(uint64_t)((s >> 6) & 1);
+    const unsigned int r = s & 63;
+
+    const uint64_t t3 = (x[3] & ~m128) | (x[1] & m128);
+    const uint64_t t2 = (x[2] & ~m128) | (x[0] & m128);
+    const uint64_t t1 = x[1] & ~m128;
+    const uint64_t t0 = x[0] & ~m128;
+
+    const uint64_t u3 = (t3 & ~m64) | (t2 & m64);
+    const uint64_t u2 = (t2 & ~m64) | (t1 & m64);
+    const uint64_t u1 = (t1 & ~m64) | (t0 & m64);
+    const uint64_t u0 = t0 & ~m64;
+
+    // (v >> 1) >> (63 - r) is v >> (64 - r) without the undefined shift by 64 when r == 0
+    x[3] = ((u3 << r) | ((u2 >> 1) >> (63 - r))) & keep;
+    x[2] = ((u2 << r) | ((u1 >> 1) >> (63 - r))) & keep;
+    x[1] = ((u1 << r) | ((u0 >> 1) >> (63 - r))) & keep;
+    x[0] = (u0 << r) & keep;
+}
+
+constexpr void shr_limbs(uint64_t (&x)[4], const unsigned int s) {
+    const uint64_t keep = -(uint64_t)(s < 256);
+    const uint64_t m128 = -(uint64_t)((s >> 7) & 1);
+    const uint64_t m64 = -(uint64_t)((s >> 6) & 1);
+    const unsigned int r = s & 63;
+
+    const uint64_t t0 = (x[0] & ~m128) | (x[2] & m128);
+    const uint64_t t1 = (x[1] & ~m128) | (x[3] & m128);
+    const uint64_t t2 = x[2] & ~m128;
+    const uint64_t t3 = x[3] & ~m128;
+
+    const uint64_t u0 = (t0 & ~m64) | (t1 & m64);
+    const uint64_t u1 = (t1 & ~m64) | (t2 & m64);
+    const uint64_t u2 = (t2 & ~m64) | (t3 & m64);
+    const uint64_t u3 = t3 & ~m64;
+
+    x[0] = ((u0 >> r) | ((u1 << 1) << (63 - r))) & keep;
+    x[1] = ((u1 >> r) | ((u2 << 1) << (63 - r))) & keep;
+    x[2] = ((u2 >> r) | ((u3 << 1) << (63 - r))) & keep;
+    x[3] = (u3 >> r) & keep;
+}
+
+// Shifts by a compile-time count; the limb loops fold down to moves and shld/shrd pairs
+template <unsigned int N>
+constexpr void shl_limbs(uint64_t (&x)[4]) {
+    constexpr unsigned int q = N / 64, r = N % 64;
+    for (int i = 3; i >= 0; i--) {
+        uint64_t v = 0;
+        if (i >= (int)q) {
+            v = x[i - q] << r;
+            if constexpr (r != 0) {
+                if (i > (int)q) {
+                    v |= x[i - q - 1] >> (64 - r);
+                }
+            }
+        }
+        x[i] = v;
+    }
+}
+
+template <unsigned int N>
+constexpr void shr_limbs(uint64_t (&x)[4]) {
+    constexpr unsigned int q = N / 64, r = N % 64;
+    for (int i = 0; i < 4; i++) {
+        uint64_t v = 0;
+        if (i + q < 4) {
+            v = x[i + q] >> r;
+            if constexpr (r != 0) {
+                if (i + q + 1 < 4) {
+                    v |= x[i + q + 1] << (64 - r);
+                }
+            }
+        }
+        x[i] = v;
+    }
+}
+
+// Knuth, TAOCP vol. 2, 4.3.1, Algorithm D on 64-bit limbs (least significant first).
+// u has m limbs, v has n >= 2 limbs with v[n - 1] != 0 and m >= n;
+// q receives m - n + 1 limbs and r receives n limbs. At most M by N limbs.
+template <int M = 8, int N = 4>
+constexpr void divmod_knuth(const uint64_t * u, const int m, const uint64_t * v, const int n, uint64_t * q, uint64_t * r) {
+    uint64_t un[M + 1], vn[N];
+
+    // D1: normalize so the top bit of the divisor is set
+    const int s = std::countl_zero(v[n - 1]);
+    for (int i = n - 1; i > 0; i--) {
+        vn[i] = (v[i] << s) | (s ? (v[i - 1] >> (64 - s)) : 0);
+    }
+    vn[0] = v[0] << s;
+    un[m] = s ? (u[m - 1] >> (64 - s)) : 0;
+    for (int i = m - 1; i > 0; i--) {
+        un[i] = (u[i] << s) | (s ? (u[i - 1] >> (64 - s)) : 0);
+    }
+    un[0] = u[0] << s;
+
+    for (int j = m - n; j >= 0; j--) {
+        // D3: estimate qhat from the top two limbs and correct it with the third
+        uint64_t qhat, rhat;
+        bool rhat_overflow = false;
+        if (un[j + n] >= vn[n - 1]) {
+            qhat = ~0ULL;
+            rhat = un[j + n - 1] + vn[n - 1];
+            rhat_overflow = rhat < vn[n - 1];
+        } else {
+            qhat = div_128_64(un[j + n], un[j + n - 1], vn[n - 1], rhat);
+        }
+        while (!rhat_overflow) {
+            uint64_t ph;
+            const uint64_t pl = mul_add_64(qhat, vn[n - 2], 0, 0, ph);
+            if ((ph < rhat) || ((ph == rhat) && (pl <= un[j + n - 2]))) {
+                break;
+            }
+            qhat--;
+            rhat += vn[n - 1];
+            rhat_overflow = rhat < vn[n - 1];
+        }
+
+        // D4: multiply and subtract
+        uint64_t k = 0, borrow = 0;
+        for (int i = 0; i < n; i++) {
+            const uint64_t p = mul_add_64(qhat, vn[i], k, 0, k);
+            const uint64_t t = un[i + j] - p;
+            const uint64_t b = un[i + j] < p;
+            un[i + j] = t - borrow;
+            borrow = b + (t < borrow);
+        }
+        const uint64_t t = un[j + n] - k;
+        const uint64_t b = un[j + n] < k;
+        un[j + n] = t - borrow;
+        borrow = b + (t < borrow);
+
+        // D6: qhat was one too large, add the divisor back
+        if (borrow) {
+            qhat--;
+            uint64_t carry = 0;
+            for (int i = 0; i < n; i++) {
+                const uint64_t sum = un[i + j] + vn[i];
+                const uint64_t c = sum < vn[i];
+                un[i + j] = sum + carry;
+                carry = c + (un[i + j] < carry);
+            }
+            un[j + n] += carry;
+        }
+        q[j] = qhat;
+    }
+
+    // D8: unnormalize the remainder
+    for (int i = 0; i < n - 1; i++) {
+        r[i] = (un[i] >> s) | (s ? (un[i + 1] << (64 - s)) : 0);
+    }
+    r[n - 1] = un[n - 1] >> s;
+}
+
+// Fixed-width kernels shared by uint256_t and wide_uint, on std::array limbs (least significant first)
+
+// r = a + b + carry, returning the carry out
+template <std::size_t N>
+constexpr uint64_t add_limbs(std::array<uint64_t, N> & r, const std::array<uint64_t, N> & a, const std::array<uint64_t, N> & b, uint64_t carry) {
+    UINT256_T_UNROLL
+    for (std::size_t i = 0; i < N; i++) {
+        r[i] = add_carry_64(a[i], b[i], carry, carry);
+    }
+    return carry;
+}
+
+// r = a - b - borrow, returning the borrow out
+template <std::size_t N>
+constexpr uint64_t sub_limbs(std::array<uint64_t, N> & r, const std::array<uint64_t, N> & a, const std::array<uint64_t, N> & b, uint64_t borrow) {
+    UINT256_T_UNROLL
+    for (std::size_t i = 0; i < N; i++) {
+        r[i] = sub_borrow_64(a[i], b[i], borrow, borrow);
+    }
+    return borrow;
+}
+
+// low N limbs of a * b; partial products above the top limb are skipped
+template <std::size_t N>
+constexpr std::array<uint64_t, N> mul_limbs(const std::array<uint64_t, N> & a, const std::array<uint64_t, N> & b) {
+    std::array<uint64_t, N> r{};
+    UINT256_T_UNROLL
+    for (std::size_t i = 0; i < N; i++) {
+        uint64_t carry = 0;
+        UINT256_T_UNROLL
+        for (std::size_t j = 0; j + 1 < N - i; j++) {
+            r[i + j] = mul_add_64(a[j], b[i], r[i + j], carry, carry);
+        }
+        r[N - 1] += a[N - 1 - i] * b[i] + carry;
+    }
+    return r;
+}
+
+// full 2N-limb product
+template <std::size_t N>
+constexpr std::array<uint64_t, 2 * N> mul_full_limbs(const std::array<uint64_t, N> & a, const std::array<uint64_t, N> & b) {
+    std::array<uint64_t, 2 * N> r{};
+    UINT256_T_UNROLL
+    for (std::size_t i = 0; i < N; i++) {
+        uint64_t carry = 0;
+        UINT256_T_UNROLL
+        for (std::size_t j = 0; j < N; j++) {
+            r[i + j] = mul_add_64(a[j], b[i], r[i + j], carry, carry);
+        }
+        r[i + N] = carry;
+    }
+    return r;
+}
+
+// 64 by 64-bit product folded to 64 bits by xoring its halves (wyhash's mum)
+constexpr uint64_t fold_mul_64(const uint64_t a, const uint64_t b) {
+    uint64_t hi = 0;
+    const uint64_t lo = mul_add_64(a, b, 0, 0, hi);
+    return lo ^ hi;
+}
+
+// Radix conversion: digits are produced backwards, ending at last
+
+inline constexpr char digit_chars[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+// "00" to "99", indexed by twice the value
+inline constexpr char digit_pairs[] =
+    "0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+    "5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+// largest power of base that fits in 64 bits, and the number of digits it covers
+struct radix_chunk {
+    uint64_t divisor;
+    int digits;
+};
+
+constexpr radix_chunk radix_chunk_for(const unsigned int base) {
+    radix_chunk c{ base, 1 };
+    while (c.divisor <= ~0ULL / base) {
+        c.divisor *= base;
+        c.digits++;
+    }
+    return c;
+}
+
+// power of two bases: each digit is a shift and a mask, reading across limbs for bases 8 and 32
+template <std::size_t L>
+constexpr char * to_chars_pow2(char * last, const uint64_t (&x)[L], const unsigned int shift) {
+    const uint64_t mask = (1ULL << shift) - 1;
+    unsigned int width = 0;
+    for (int i = (int)L - 1; i >= 0; i--) {
+        if (x[i]) {
+            width = i * 64 + std::bit_width(x[i]);
+            break;
+        }
+    }
+    if (!width) {
+        *--last = '0';
+    }
+    for (unsigned int p = 0; p < width; p += shift) {
+        const unsigned int i = p / 64, o = p % 64;
+        uint64_t d = x[i] >> o;
+        if ((o + shift > 64) && (i + 1 < L)) {
+            d |= x[i + 1] << (64 - o);
+        }
+        *--last = digit_chars[d & mask];
+    }
+    return last;
+}
+
+// one 64-bit chunk, two decimal digits per step; zero padded to digits when pad is set
+constexpr char * to_chars_chunk(char * last, uint64_t v, const unsigned int base, const int digits, const bool pad) {
+    char * const stop = last - digits;
+    if (base == 10) {
+        // eight digits at a time leave the 64-bit chain; each group is formatted in 32 bits
+        while (v >= 100000000) {
+            const uint64_t q = v / 100000000;
+            uint32_t g = (uint32_t)(v - q * 100000000);
+            v = q;
+            for (int i = 0; i < 4; i++) {
+                const unsigned int p = (g % 100) * 2;
+                g /= 100;
+                *--last = digit_pairs[p + 1];
+                *--last = digit_pairs[p];
+            }
+        }
+        uint32_t w = (uint32_t)v;
+        while (w >= 100) {
+            const unsigned int p = (w % 100) * 2;
+            w /= 100;
+            *--last = digit_pairs[p + 1];
+            *--last = digit_pairs[p];
+        }
+        if (w >= 10) {
+            *--last = digit_pairs[w * 2 + 1];
+            *--last = digit_pairs[w * 2];
+        } else {
+            *--last = (char)('0' + w);
+        }
+    } else {
+        do {
+            *--last = digit_chars[v % base];
+            v /= base;
+        } while (v);
+    }
+    while (pad && (last > stop)) {
+        *--last = '0';
+    }
+    return last;
+}
+
+// 10^19, the decimal chunk divisor, is already normalized
+inline constexpr reciprocal_64 decimal_chunk_reciprocal = make_reciprocal_64(radix_chunk_for(10).divisor);
+
+// other bases: peel off base^digits chunks, dividing every limb by the chunk's reciprocal
+template <std::size_t L>
+constexpr char * to_chars_radix(char * last, uint64_t (&x)[L], const unsigned int base) {
+    const radix_chunk c = radix_chunk_for(base);
+    const reciprocal_64 rec = (base == 10) ? decimal_chunk_reciprocal : make_reciprocal_64(c.divisor);
+    int n = (int)L;
+    while ((n > 1) && !x[n - 1]) {
+        n--;
+    }
+    while ((n > 1) || (x[0] >= c.divisor)) {
+        const uint64_t r = div_limbs_preinv(x, n, rec);
+        if (!x[n - 1]) {
+            n--;
+        }
+        last = to_chars_chunk(last, r, base, c.digits, true);
+    }
+    return to_chars_chunk(last, x[0], base, c.digits, false);
+}
+
+// Parsing: digits are accumulated into a 64-bit chunk, then folded into the limbs
+
+// 0-35 for [0-9a-zA-Z], 36 otherwise
+struct digit_table {
+    uint8_t value[256];
+};
+
+constexpr digit_table make_digit_table() {
+    digit_table t{};
+    for (int c = 0; c < 256; c++) {
+        t.value[c] = ('0' <= c && c <= '9') ? c - '0'
+                   : ('a' <= c && c <= 'z') ? c - 'a' + 10
+                   : ('A' <= c && c <= 'Z') ? c - 'A' + 10
+                   : 36;
+    }
+    return t;
+}
+
+inline constexpr digit_table digit_values = make_digit_table();
+
+constexpr unsigned int digit_value(const char c) {
+    return digit_values.value[(unsigned char)c];
+}
+
+// eight decimal digits at once (SWAR, little endian); returns false if any byte is not a digit
+inline bool parse_8_digits(const char * p, uint64_t & out) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    if ((((v & 0xf0f0f0f0f0f0f0f0ULL) | (((v + 0x0606060606060606ULL) & 0xf0f0f0f0f0f0f0f0ULL) >> 4))) != 0x3333333333333333ULL) {
+        return false;
+    }
+    v -= 0x3030303030303030ULL;
+    v = (v * 10) + (v >> 8);
+    v = (((v & 0x000000ff000000ffULL) * (100 + (1000000ULL << 32))) + (((v >> 16) & 0x000000ff000000ffULL) * (1 + (10000ULL << 32)))) >> 32;
+    out = v;
+    return true;
+}
+
+// x = x * m + v; returns false when the result does not fit in 256 bits
+constexpr bool mul_add_limbs(uint64_t (&x)[4], const uint64_t m, const uint64_t v) {
+    uint64_t carry = v;
+    for (int i = 0; i < 4; i++) {
+        x[i] = mul_add_64(x[i], m, carry, 0, carry);
+    }
+    return !carry;
+}
+
+// x = (x << bits) | v for 0 < bits <= 64; returns false when bits are shifted out
+constexpr bool shl_or_limbs(uint64_t (&x)[4], const unsigned int bits, const uint64_t v) {
+    const bool fits = (bits < 64) ? !(x[3] >> (64 - bits)) : !x[3];
+    shl_limbs(x, bits);
+    x[0] |= v;
+    return fits;
+}
+
+// Byte serialization: limbs go through std::bit_cast so the copies stay constexpr;
+// on little endian hosts the little endian form is a plain copy and big endian adds a bswap per limb
+
+constexpr uint64_t byteswap_64(const uint64_t v) {
+#if defined(__cpp_lib_byteswap)
+    return std::byteswap(v);
+#else
+    return ((v & 0x00000000000000ffULL) << 56) | ((v & 0x000000000000ff00ULL) << 40) |
+           ((v & 0x0000000000ff0000ULL) << 24) | ((v & 0x00000000ff000000ULL) <<  8) |
+           ((v & 0x000000ff00000000ULL) >>  8) | ((v & 0x0000ff0000000000ULL) >> 24) |
+           ((v & 0x00ff000000000000ULL) >> 40) | ((v & 0xff00000000000000ULL) >> 56);
+#endif
+}
+
+// host order limb to/from its little (or big) endian byte image
+constexpr uint64_t to_little_endian(const uint64_t v) {
+    return (std::endian::native == std::endian::little) ? v : byteswap_64(v);
+}
+
+constexpr uint64_t to_big_endian(const uint64_t v) {
+    return (std::endian::native == std::endian::big) ? v : byteswap_64(v);
+}
+
+constexpr void store_limb(std::byte * out, const uint64_t v) {
+    const std::array<std::byte, 8> b = std::bit_cast<std::array<std::byte, 8>>(v);
+    for (int i = 0; i < 8; i++) {
+        out[i] = b[i];
+    }
+}
+
+constexpr uint64_t load_limb(const std::byte * in) {
+    std::array<std::byte, 8> b;
+    for (int i = 0; i < 8; i++) {
+        b[i] = in[i];
+    }
+    return std::bit_cast<uint64_t>(b);
+}
+
+}
 
 class uint256_t;
 
@@ -143,19 +847,20 @@ public:
     {
     }
 
-    //  RHS input args only
-    constexpr std::vector<uint8_t> export_bits() const {
-        std::vector<uint8_t> ret;
-        ret.reserve(32);
-        upper_.export_bits(ret);
-        lower_.export_bits(ret);
-        return ret;
-    }
+    // 32-byte serialization, most (be) or least (le) significant byte first
+    constexpr void to_bytes_be(std::span<std::byte, 32> out) const;
+    constexpr void to_bytes_le(std::span<std::byte, 32> out) const;
+    constexpr std::array<std::byte, 32> to_bytes_be() const;
+    constexpr std::array<std::byte, 32> to_bytes_le() const;
+    static constexpr uint256_t from_bytes_be(std::span<const std::byte, 32> in);
+    static constexpr uint256_t from_bytes_le(std::span<const std::byte, 32> in);
 
-    std::vector<uint8_t> export_bits_truncate() const;
+    //  RHS input args only
+    constexpr std::vector<uint8_t> export_bits() const;
+    constexpr std::vector<uint8_t> export_bits_truncate() const;
 
     template <typename T, typename = typename std::enable_if <std::is_integral<T>::value, T>::type>
-    uint256_t & operator=(const T & rhs) {
+    constexpr uint256_t & operator=(const T & rhs) {
         upper_ = uint128_0;
 
         if (std::is_signed<T>::value) {
@@ -168,513 +873,1495 @@ public:
         return *this;
     }
 
-    uint256_t & operator=(const bool & rhs);
+    constexpr uint256_t & operator=(const bool & rhs);
 
     // Typecast Operators
-    operator bool() const;
-    operator uint8_t   () const;
-    operator uint16_t  () const;
-    operator uint32_t  () const;
-    operator uint64_t  () const;
-    operator uint128_t () const;
+    constexpr operator bool() const;
+    constexpr operator uint8_t   () const;
+    constexpr operator uint16_t  () const;
+    constexpr operator uint32_t  () const;
+    constexpr operator uint64_t  () const;
+    constexpr operator uint128_t () const;
 
     // Bitwise Operators
-    uint256_t operator&(const uint128_t & rhs) const;
-    uint256_t operator&(const uint256_t & rhs) const;
+    constexpr uint256_t operator&(const uint128_t & rhs) const;
+    constexpr uint256_t operator&(const uint256_t & rhs) const;
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t operator&(const T & rhs) const {
+    constexpr uint256_t operator&(const T & rhs) const {
         return uint256_t(uint128_0, lower_ & (uint128_t)rhs);
     }
 
-    uint256_t & operator&=(const uint128_t & rhs);
-    uint256_t & operator&=(const uint256_t & rhs);
+    constexpr uint256_t & operator&=(const uint128_t & rhs);
+    constexpr uint256_t & operator&=(const uint256_t & rhs);
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t & operator&=(const T & rhs) {
+    constexpr uint256_t & operator&=(const T & rhs) {
         upper_ = uint128_0;
         lower_ &= rhs;
         return *this;
     }
 
-    uint256_t operator|(const uint128_t & rhs) const;
-    uint256_t operator|(const uint256_t & rhs) const;
+    constexpr uint256_t operator|(const uint128_t & rhs) const;
+    constexpr uint256_t operator|(const uint256_t & rhs) const;
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t operator|(const T & rhs) const {
+    constexpr uint256_t operator|(const T & rhs) const {
         return uint256_t(upper_, lower_ | uint128_t(rhs));
     }
 
-    uint256_t & operator|=(const uint128_t & rhs);
-    uint256_t & operator|=(const uint256_t & rhs);
+    constexpr uint256_t & operator|=(const uint128_t & rhs);
+    constexpr uint256_t & operator|=(const uint256_t & rhs);
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t & operator|=(const T & rhs) {
+    constexpr uint256_t & operator|=(const T & rhs) {
         lower_ |= (uint128_t)rhs;
         return *this;
     }
 
-    uint256_t operator^(const uint128_t & rhs) const;
-    uint256_t operator^(const uint256_t & rhs) const;
+    constexpr uint256_t operator^(const uint128_t & rhs) const;
+    constexpr uint256_t operator^(const uint256_t & rhs) const;
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t operator^(const T & rhs) const {
+    constexpr uint256_t operator^(const T & rhs) const {
         return uint256_t(upper_, lower_ ^ (uint128_t)rhs);
     }
 
-    uint256_t & operator^=(const uint128_t & rhs);
-    uint256_t & operator^=(const uint256_t & rhs);
+    constexpr uint256_t & operator^=(const uint128_t & rhs);
+    constexpr uint256_t & operator^=(const uint256_t & rhs);
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t & operator^=(const T & rhs) {
+    constexpr uint256_t & operator^=(const T & rhs) {
         lower_ ^= (uint128_t)rhs;
         return *this;
     }
 
-    uint256_t operator~() const;
+    constexpr uint256_t operator~() const;
 
     // Bit Shift Operators
-    uint256_t operator<<(const uint128_t & shift) const;
-    uint256_t operator<<(const uint256_t & shift) const;
-
-    template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t operator<<(const T & rhs) const {
-        return *this << uint256_t(rhs);
-    }
-
-    uint256_t & operator<<=(const uint128_t & shift);
-    uint256_t & operator<<=(const uint256_t & shift);
+    constexpr uint256_t operator<<(const unsigned int shift) const;
+    constexpr uint256_t operator<<(const uint128_t & shift) const;
+    constexpr uint256_t operator<<(const uint256_t & shift) const;
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t & operator<<=(const T & rhs) {
-        *this = *this << uint256_t(rhs);
-        return *this;
+    constexpr uint256_t operator<<(const T & rhs) const {
+        return *this << uint256::detail::shift_count(rhs);
     }
 
-    uint256_t operator>>(const uint128_t & shift) const;
-    uint256_t operator>>(const uint256_t & shift) const;
+    constexpr uint256_t & operator<<=(const unsigned int shift);
+    constexpr uint256_t & operator<<=(const uint128_t & shift);
+    constexpr uint256_t & operator<<=(const uint256_t & shift);
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t operator>>(const T & rhs) const {
-        return *this >> uint256_t(rhs);
+    constexpr uint256_t & operator<<=(const T & rhs) {
+        return *this <<= uint256::detail::shift_count(rhs);
     }
 
-    uint256_t & operator>>=(const uint128_t & shift);
-    uint256_t & operator>>=(const uint256_t & shift);
+    constexpr uint256_t operator>>(const unsigned int shift) const;
+    constexpr uint256_t operator>>(const uint128_t & shift) const;
+    constexpr uint256_t operator>>(const uint256_t & shift) const;
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t & operator>>=(const T & rhs) {
-        *this = *this >> uint256_t(rhs);
-        return *this;
+    constexpr uint256_t operator>>(const T & rhs) const {
+        return *this >> uint256::detail::shift_count(rhs);
     }
 
-    // Logical Operators
-    bool operator!() const;
-
-    bool operator&&(const uint128_t & rhs) const;
-    bool operator&&(const uint256_t & rhs) const;
+    constexpr uint256_t & operator>>=(const unsigned int shift);
+    constexpr uint256_t & operator>>=(const uint128_t & shift);
+    constexpr uint256_t & operator>>=(const uint256_t & shift);
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    bool operator&&(const T & rhs) const {
-        return ((bool)*this && rhs);
+    constexpr uint256_t & operator>>=(const T & rhs) {
+        return *this >>= uint256::detail::shift_count(rhs);
     }
 
-    bool operator||(const uint128_t & rhs) const;
-    bool operator||(const uint256_t & rhs) const;
-
-    template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    bool operator||(const T & rhs) const {
-        return ((bool)*this || rhs);
+    // Shifts by a compile-time count
+    template <unsigned int N>
+    constexpr uint256_t shl() const {
+        static_assert(N < 256, "shift count must be less than 256");
+        uint64_t x[4] = { lower_.lower(), lower_.upper(), upper_.lower(), upper_.upper() };
+        uint256::detail::shl_limbs<N>(x);
+        return uint256_t(x[3], x[2], x[1], x[0]);
     }
 
-    // Comparison Operators
-    bool operator==(const uint128_t & rhs) const;
-    bool operator==(const uint256_t & rhs) const;
-
-    template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    bool operator==(const T & rhs) const {
-        return (!upper_ && (lower_ == uint128_t(rhs)));
+    template <unsigned int N>
+    constexpr uint256_t shr() const {
+        static_assert(N < 256, "shift count must be less than 256");
+        uint64_t x[4] = { lower_.lower(), lower_.upper(), upper_.lower(), upper_.upper() };
+        uint256::detail::shr_limbs<N>(x);
+        return uint256_t(x[3], x[2], x[1], x[0]);
     }
 
-    bool operator!=(const uint128_t & rhs) const;
-    bool operator!=(const uint256_t & rhs) const;
-
-    template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    bool operator!=(const T & rhs) const {
-        return ((bool)upper_ | (lower_ != uint128_t(rhs)));
-    }
+    // Logical Operators
+    constexpr bool operator!() const;
 
-    bool operator>(const uint128_t & rhs) const;
-    bool operator>(const uint256_t & rhs) const;
+    constexpr bool operator&&(const uint128_t & rhs) const;
+    constexpr bool operator&&(const uint256_t & rhs) const;
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    bool operator>(const T & rhs) const {
-        return ((bool)upper_ | (lower_ > uint128_t(rhs)));
+    constexpr bool operator&&(const T & rhs) const {
+        return ((bool)*this && rhs);
     }
 
-    bool operator<(const uint128_t & rhs) const;
-    bool operator<(const uint256_t & rhs) const;
+    constexpr bool operator||(const uint128_t & rhs) const;
+    constexpr bool operator||(const uint256_t & rhs) const;
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    bool operator<(const T & rhs) const {
-        return (!upper_) ? (lower_ < uint128_t(rhs)) : false;
+    constexpr bool operator||(const T & rhs) const {
+        return ((bool)*this || rhs);
     }
 
-    bool operator>=(const uint128_t & rhs) const;
-    bool operator>=(const uint256_t & rhs) const;
+    // Comparison Operators
+    // integral operands compare as if converted to uint256_t; !=, <, >, <= and >= are rewritten from these
+    constexpr bool operator==(const uint128_t & rhs) const;
+    constexpr bool operator==(const uint256_t & rhs) const;
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    bool operator>=(const T & rhs) const {
-        return ((*this > rhs) | (*this == rhs));
+    constexpr bool operator==(const T & rhs) const {
+        return (*this == uint256_t(rhs));
     }
 
-    bool operator<=(const uint128_t & rhs) const;
-    bool operator<=(const uint256_t & rhs) const;
+    constexpr std::strong_ordering operator<=>(const uint128_t & rhs) const;
+    constexpr std::strong_ordering operator<=>(const uint256_t & rhs) const;
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    bool operator<=(const T & rhs) const {
-        return ((*this < rhs) | (*this == rhs));
+    constexpr std::strong_ordering operator<=>(const T & rhs) const {
+        return (*this <=> uint256_t(rhs));
     }
 
     // Arithmetic Operators
-    uint256_t operator+(const uint128_t & rhs) const;
-    uint256_t operator+(const uint256_t & rhs) const;
+    constexpr uint256_t operator+(const uint128_t & rhs) const;
+    constexpr uint256_t operator+(const uint256_t & rhs) const;
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t operator+(const T & rhs) const {
+    constexpr uint256_t operator+(const T & rhs) const {
         return uint256_t(upper_ + ((lower_ + (uint128_t)rhs) < lower_), lower_ + (uint128_t)rhs);
     }
 
-    uint256_t & operator+=(const uint128_t & rhs);
-    uint256_t & operator+=(const uint256_t & rhs);
+    constexpr uint256_t & operator+=(const uint128_t & rhs);
+    constexpr uint256_t & operator+=(const uint256_t & rhs);
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t & operator+=(const T & rhs) {
+    constexpr uint256_t & operator+=(const T & rhs) {
         return *this += uint256_t(rhs);
     }
 
-    uint256_t operator-(const uint128_t & rhs) const;
-    uint256_t operator-(const uint256_t & rhs) const;
+    constexpr uint256_t operator-(const uint128_t & rhs) const;
+    constexpr uint256_t operator-(const uint256_t & rhs) const;
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t operator-(const T & rhs) const {
+    constexpr uint256_t operator-(const T & rhs) const {
         return uint256_t(upper_ - ((lower_ - rhs) > lower_), lower_ - rhs);
     }
 
-    uint256_t & operator-=(const uint128_t & rhs);
-    uint256_t & operator-=(const uint256_t & rhs);
+    constexpr uint256_t & operator-=(const uint128_t & rhs);
+    constexpr uint256_t & operator-=(const uint256_t & rhs);
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t & operator-=(const T & rhs) {
+    constexpr uint256_t & operator-=(const T & rhs) {
         return *this = *this - uint256_t(rhs);
     }
 
-    uint256_t operator*(const uint128_t & rhs) const;
-    uint256_t operator*(const uint256_t & rhs) const;
+    constexpr uint256_t operator*(const uint128_t & rhs) const;
+    constexpr uint256_t operator*(const uint256_t & rhs) const;
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t operator*(const T & rhs) const {
+    constexpr uint256_t operator*(const T & rhs) const {
         return *this * uint256_t(rhs);
     }
 
-    uint256_t & operator*=(const uint128_t & rhs);
-    uint256_t & operator*=(const uint256_t & rhs);
+    constexpr uint256_t & operator*=(const uint128_t & rhs);
+    constexpr uint256_t & operator*=(const uint256_t & rhs);
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t & operator*=(const T & rhs) {
+    constexpr uint256_t & operator*=(const T & rhs) {
         return *this = *this * uint256_t(rhs);
     }
 
 private:
-    std::pair <uint256_t, uint256_t> divmod(const uint256_t & lhs, const uint256_t & rhs) const;
-    void init(const char * s);
-
-    constexpr void init_from_base(std::string_view const s, uint8_t const base) {
-        *this = 0;
-
-        uint256_t power{ 1 };
-        uint8_t digit;
-        int pos = s.length() - 1;
-        while (pos >= 0) {
-            digit = 0;
-            if ('0' <= s[pos] && s[pos] <= '9') {
-                digit = s[pos] - '0';
-            } else if ('a' <= s[pos] && s[pos] <= 'z') {
-                digit = s[pos] - 'a' + 10;
-            } else if ('A' <= s[pos] && s[pos] <= 'Z') {
-                               digit = s[pos] - 'A' + 10;
-            } else {
-                throw std::invalid_argument("Invalid character in string");
-            }
-
-            *this += digit * power;
-            pos--;
-            power *= base;
-        }
-    }
+    constexpr void init_from_base(std::string_view const s, uint8_t const base);
 
 public:
-    uint256_t operator/(const uint128_t & rhs) const;
-    uint256_t operator/(const uint256_t & rhs) const;
+    // Quotient and remainder of a single division
+    static constexpr std::pair <uint256_t, uint256_t> divmod(const uint256_t & lhs, const uint256_t & rhs);
+    static constexpr std::pair <uint256_t, uint128_t> divmod(const uint256_t & lhs, const uint128_t & rhs);
+    static constexpr std::pair <uint256_t, uint64_t> divmod(const uint256_t & lhs, const uint64_t & rhs);
+
+    constexpr uint256_t operator/(const uint128_t & rhs) const;
+    constexpr uint256_t operator/(const uint256_t & rhs) const;
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t operator/(const T & rhs) const {
+    constexpr uint256_t operator/(const T & rhs) const {
         return *this / uint256_t(rhs);
     }
 
-    uint256_t & operator/=(const uint128_t & rhs);
-    uint256_t & operator/=(const uint256_t & rhs);
+    constexpr uint256_t & operator/=(const uint128_t & rhs);
+    constexpr uint256_t & operator/=(const uint256_t & rhs);
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t & operator/=(const T & rhs) {
+    constexpr uint256_t & operator/=(const T & rhs) {
         return *this = *this / uint256_t(rhs);
     }
 
-    uint256_t operator%(const uint128_t & rhs) const;
-    uint256_t operator%(const uint256_t & rhs) const;
+    constexpr uint256_t operator%(const uint128_t & rhs) const;
+    constexpr uint256_t operator%(const uint256_t & rhs) const;
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t operator%(const T & rhs) const {
+    constexpr uint256_t operator%(const T & rhs) const {
         return *this % uint256_t(rhs);
     }
 
-    uint256_t & operator%=(const uint128_t & rhs);
-    uint256_t & operator%=(const uint256_t & rhs);
+    constexpr uint256_t & operator%=(const uint128_t & rhs);
+    constexpr uint256_t & operator%=(const uint256_t & rhs);
 
     template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-    uint256_t & operator%=(const T & rhs) {
+    constexpr uint256_t & operator%=(const T & rhs) {
         return *this = *this % uint256_t(rhs);
     }
 
     // Increment Operators
-    uint256_t & operator++();
-    uint256_t operator++(int);
+    constexpr uint256_t & operator++();
+    constexpr uint256_t operator++(int);
 
     // Decrement Operators
-    uint256_t & operator--();
-    uint256_t operator--(int);
+    constexpr uint256_t & operator--();
+    constexpr uint256_t operator--(int);
 
     // Nothing done since promotion doesn't work here
-    uint256_t operator+() const;
+    constexpr uint256_t operator+() const;
 
     // two's complement
-    uint256_t operator-() const;
+    constexpr uint256_t operator-() const;
 
     // Get private values
-    const uint128_t & upper() const;
-    const uint128_t & lower() const;
+    constexpr const uint128_t & upper() const;
+    constexpr const uint128_t & lower() const;
 
     // Get bitsize of value
-    uint16_t bits() const;
+    constexpr uint16_t bits() const;
 
     // Get string representation of value
-    std::string str(uint8_t base = 10, const unsigned int & len = 0) const;
+    constexpr std::string str(uint8_t base = 10, const unsigned int & len = 0) const;
 };
 
+// The layout is part of the interface: two uint128_t halves in native order with no padding,
+// so values can be memcpy'd, mapped from files and shared between processes. Alignment stays
+// that of uint128_t; uint256_atomic.h has a 32-byte aligned variant.
+static_assert(sizeof(uint256_t) == 32, "uint256_t must be 32 bytes; endianness.h must define __LITTLE_ENDIAN__ or __BIG_ENDIAN__");
+static_assert(std::is_trivially_copyable_v<uint256_t>, "uint256_t must be trivially copyable");
+static_assert(std::is_standard_layout_v<uint256_t>, "uint256_t must be standard layout");
+
 // useful values
-UINT256_T_EXTERN extern const uint128_t uint128_64;
-UINT256_T_EXTERN extern const uint128_t uint128_128;
-UINT256_T_EXTERN extern const uint128_t uint128_256;
-UINT256_T_EXTERN extern const uint256_t uint256_0;
-UINT256_T_EXTERN extern const uint256_t uint256_1;
-UINT256_T_EXTERN extern const uint256_t uint256_max;
+inline constexpr uint128_t uint128_64{ 64 };
+inline constexpr uint128_t uint128_128{ 128 };
+inline constexpr uint128_t uint128_256{ 256 };
+inline constexpr uint256_t uint256_0{ 0 };
+inline constexpr uint256_t uint256_1{ 1 };
+inline constexpr uint256_t uint256_max{ uint128_t{ (uint64_t)-1, (uint64_t)-1 }, uint128_t{ (uint64_t)-1, (uint64_t)-1 } };
 
 // Bitwise Operators
-UINT256_T_EXTERN uint256_t operator&(const uint128_t & lhs, const uint256_t & rhs);
+constexpr uint256_t operator&(const uint128_t & lhs, const uint256_t & rhs) {
+    return rhs & lhs;
+}
 
 template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-uint256_t operator&(const T & lhs, const uint256_t & rhs) {
+constexpr uint256_t operator&(const T & lhs, const uint256_t & rhs) {
     return rhs & lhs;
 }
 
-UINT256_T_EXTERN uint128_t & operator&=(uint128_t & lhs, const uint256_t & rhs);
+constexpr uint128_t & operator&=(uint128_t & lhs, const uint256_t & rhs) {
+    lhs = (rhs & lhs).lower();
+    return lhs;
+}
 
 template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-T & operator&=(T & lhs, const uint256_t & rhs) {
+constexpr T & operator&=(T & lhs, const uint256_t & rhs) {
     return lhs = static_cast <T> (rhs & lhs);
 }
 
-UINT256_T_EXTERN uint256_t operator|(const uint128_t & lhs, const uint256_t & rhs);
+constexpr uint256_t operator|(const uint128_t & lhs, const uint256_t & rhs) {
+    return rhs | lhs;
+}
 
 template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-uint256_t operator|(const T & lhs, const uint256_t & rhs) {
+constexpr uint256_t operator|(const T & lhs, const uint256_t & rhs) {
     return rhs | lhs;
 }
 
-UINT256_T_EXTERN uint128_t & operator|=(uint128_t & lhs, const uint256_t & rhs);
+constexpr uint128_t & operator|=(uint128_t & lhs, const uint256_t & rhs) {
+    lhs = (rhs | lhs).lower();
+    return lhs;
+}
 
 template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-T & operator|=(T & lhs, const uint256_t & rhs) {
+constexpr T & operator|=(T & lhs, const uint256_t & rhs) {
     return lhs = static_cast <T> (rhs | lhs);
 }
 
-UINT256_T_EXTERN uint256_t operator^(const uint128_t & lhs, const uint256_t & rhs);
+constexpr uint256_t operator^(const uint128_t & lhs, const uint256_t & rhs) {
+    return rhs ^ lhs;
+}
 
 template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-uint256_t operator^(const T & lhs, const uint256_t & rhs) {
+constexpr uint256_t operator^(const T & lhs, const uint256_t & rhs) {
     return rhs ^ lhs;
 }
 
-uint128_t & operator^=(uint128_t & lhs, const uint256_t & rhs);
+constexpr uint128_t & operator^=(uint128_t & lhs, const uint256_t & rhs) {
+    lhs = (rhs ^ lhs).lower();
+    return lhs;
+}
 
 template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-T & operator^=(T & lhs, const uint256_t & rhs) {
+constexpr T & operator^=(T & lhs, const uint256_t & rhs) {
     return lhs = static_cast <T> (rhs ^ lhs);
 }
 
 // Bitshift operators
-UINT256_T_EXTERN uint256_t operator<<(const bool & lhs, const uint256_t & rhs);
-UINT256_T_EXTERN uint256_t operator<<(const uint8_t & lhs, const uint256_t & rhs);
-UINT256_T_EXTERN uint256_t operator<<(const uint16_t & lhs, const uint256_t & rhs);
-UINT256_T_EXTERN uint256_t operator<<(const uint32_t & lhs, const uint256_t & rhs);
-UINT256_T_EXTERN uint256_t operator<<(const uint64_t & lhs, const uint256_t & rhs);
-UINT256_T_EXTERN uint256_t operator<<(const uint128_t & lhs, const uint256_t & rhs);
-UINT256_T_EXTERN uint256_t operator<<(const int8_t & lhs, const uint256_t & rhs);
-UINT256_T_EXTERN uint256_t operator<<(const int16_t & lhs, const uint256_t & rhs);
-UINT256_T_EXTERN uint256_t operator<<(const int32_t & lhs, const uint256_t & rhs);
-UINT256_T_EXTERN uint256_t operator<<(const int64_t & lhs, const uint256_t & rhs);
-
-UINT256_T_EXTERN uint128_t & operator<<=(uint128_t & lhs, const uint256_t & rhs);
+constexpr uint256_t operator<<(const bool & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) << rhs;
+}
+constexpr uint256_t operator<<(const uint8_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) << rhs;
+}
+constexpr uint256_t operator<<(const uint16_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) << rhs;
+}
+constexpr uint256_t operator<<(const uint32_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) << rhs;
+}
+constexpr uint256_t operator<<(const uint64_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) << rhs;
+}
+constexpr uint256_t operator<<(const uint128_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) << rhs;
+}
+constexpr uint256_t operator<<(const int8_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) << rhs;
+}
+constexpr uint256_t operator<<(const int16_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) << rhs;
+}
+constexpr uint256_t operator<<(const int32_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) << rhs;
+}
+constexpr uint256_t operator<<(const int64_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) << rhs;
+}
 
-template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-T & operator<<=(T & lhs, const uint256_t & rhs) {
-    lhs = static_cast <T> (uint256_t(lhs) << rhs);
+constexpr uint128_t & operator<<=(uint128_t & lhs, const uint256_t & rhs) {
+    lhs = (uint256_t(lhs) << rhs).lower();
     return lhs;
 }
 
-UINT256_T_EXTERN uint256_t operator>>(const bool & lhs, const uint256_t & rhs);
-UINT256_T_EXTERN uint256_t operator>>(const uint8_t & lhs, const uint256_t & rhs);
-UINT256_T_EXTERN uint256_t operator>>(const uint16_t & lhs, const uint256_t & rhs);
-UINT256_T_EXTERN uint256_t operator>>(const uint32_t & lhs, const uint256_t & rhs);
-UINT256_T_EXTERN uint256_t operator>>(const uint64_t & lhs, const uint256_t & rhs);
-UINT256_T_EXTERN uint256_t operator>>(const uint128_t & lhs, const uint256_t & rhs);
-UINT256_T_EXTERN uint256_t operator>>(const int8_t & lhs, const uint256_t & rhs);
-UINT256_T_EXTERN uint256_t operator>>(const int16_t & lhs, const uint256_t & rhs);
-UINT256_T_EXTERN uint256_t operator>>(const int32_t & lhs, const uint256_t & rhs);
-UINT256_T_EXTERN uint256_t operator>>(const int64_t & lhs, const uint256_t & rhs);
-
-UINT256_T_EXTERN uint128_t & operator>>=(uint128_t & lhs, const uint256_t & rhs);
-
 template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-T & operator>>=(T & lhs, const uint256_t & rhs) {
-    return lhs = static_cast <T> (uint256_t(lhs) >> rhs);
+constexpr T & operator<<=(T & lhs, const uint256_t & rhs) {
+    lhs = static_cast <T> (uint256_t(lhs) << rhs);
+    return lhs;
 }
 
-// Comparison Operators
-UINT256_T_EXTERN bool operator==(const uint128_t & lhs, const uint256_t & rhs);
-
-template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-bool operator==(const T & lhs, const uint256_t & rhs) {
-    return (!rhs.upper() && ((uint64_t)lhs == rhs.lower()));
+constexpr uint256_t operator>>(const bool & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) >> rhs;
 }
-
-UINT256_T_EXTERN bool operator!=(const uint128_t & lhs, const uint256_t & rhs);
-
-template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-bool operator!=(const T & lhs, const uint256_t & rhs) {
-    return (rhs.upper() | ((uint64_t)lhs != rhs.lower()));
+constexpr uint256_t operator>>(const uint8_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) >> rhs;
 }
-
-UINT256_T_EXTERN bool operator>(const uint128_t & lhs, const uint256_t & rhs);
-
-template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-bool operator>(const T & lhs, const uint256_t & rhs) {
-    return rhs.upper() ? false : ((uint128_t)lhs > rhs.lower());
+constexpr uint256_t operator>>(const uint16_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) >> rhs;
 }
-
-UINT256_T_EXTERN bool operator<(const uint128_t & lhs, const uint256_t & rhs);
-
-template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-bool operator<(const T & lhs, const uint256_t & rhs) {
-    return rhs.upper() ? true : ((uint128_t)lhs < rhs.lower());
+constexpr uint256_t operator>>(const uint32_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) >> rhs;
+}
+constexpr uint256_t operator>>(const uint64_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) >> rhs;
+}
+constexpr uint256_t operator>>(const uint128_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) >> rhs;
+}
+constexpr uint256_t operator>>(const int8_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) >> rhs;
+}
+constexpr uint256_t operator>>(const int16_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) >> rhs;
+}
+constexpr uint256_t operator>>(const int32_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) >> rhs;
+}
+constexpr uint256_t operator>>(const int64_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) >> rhs;
 }
 
-UINT256_T_EXTERN bool operator>=(const uint128_t & lhs, const uint256_t & rhs);
+constexpr uint128_t & operator>>=(uint128_t & lhs, const uint256_t & rhs) {
+    lhs = (uint256_t(lhs) >> rhs).lower();
+    return lhs;
+}
 
 template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-bool operator>=(const T & lhs, const uint256_t & rhs) {
-    return rhs.upper() ? false : ((uint128_t)lhs >= rhs.lower());
+constexpr T & operator>>=(T & lhs, const uint256_t & rhs) {
+    return lhs = static_cast <T> (uint256_t(lhs) >> rhs);
 }
 
-UINT256_T_EXTERN bool operator<=(const uint128_t & lhs, const uint256_t & rhs);
+// Comparison Operators
+// uint128_t's own integral templates would otherwise truncate rhs when uint128_t is on the left
+constexpr bool operator==(const uint128_t & lhs, const uint256_t & rhs) {
+    return rhs == lhs;
+}
 
-template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-bool operator<=(const T & lhs, const uint256_t & rhs) {
-    return rhs.upper() ? true : ((uint128_t)lhs <= rhs.lower());
+constexpr std::strong_ordering operator<=>(const uint128_t & lhs, const uint256_t & rhs) {
+    return 0 <=> (rhs <=> lhs);
 }
 
 // Arithmetic Operators
-UINT256_T_EXTERN uint256_t operator+(const uint128_t & lhs, const uint256_t & rhs);
+constexpr uint256_t operator+(const uint128_t & lhs, const uint256_t & rhs) {
+    return rhs + lhs;
+}
 
 template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-uint256_t operator+(const T & lhs, const uint256_t & rhs) {
+constexpr uint256_t operator+(const T & lhs, const uint256_t & rhs) {
     return rhs + lhs;
 }
 
-UINT256_T_EXTERN uint128_t & operator+=(uint128_t & lhs, const uint256_t & rhs);
+constexpr uint128_t & operator+=(uint128_t & lhs, const uint256_t & rhs) {
+    lhs = (rhs + lhs).lower();
+    return lhs;
+}
 
 template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-T & operator+=(T & lhs, const uint256_t & rhs) {
+constexpr T & operator+=(T & lhs, const uint256_t & rhs) {
     lhs = static_cast <T> (rhs + lhs);
     return lhs;
 }
 
-UINT256_T_EXTERN uint256_t operator-(const uint128_t & lhs, const uint256_t & rhs);
+constexpr uint256_t operator-(const uint128_t & lhs, const uint256_t & rhs) {
+    return -(rhs - lhs);
+}
 
 template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-uint256_t operator-(const T & lhs, const uint256_t & rhs) {
+constexpr uint256_t operator-(const T & lhs, const uint256_t & rhs) {
     return -(rhs - lhs);
 }
 
-UINT256_T_EXTERN uint128_t & operator-=(uint128_t & lhs, const uint256_t & rhs);
+constexpr uint128_t & operator-=(uint128_t & lhs, const uint256_t & rhs) {
+    lhs = (-(rhs - lhs)).lower();
+    return lhs;
+}
 
 template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-T & operator-=(T & lhs, const uint256_t & rhs) {
+constexpr T & operator-=(T & lhs, const uint256_t & rhs) {
     return lhs = static_cast <T> (-(rhs - lhs));
 }
 
-UINT256_T_EXTERN uint256_t operator*(const uint128_t & lhs, const uint256_t & rhs);
+constexpr uint256_t operator*(const uint128_t & lhs, const uint256_t & rhs) {
+    return rhs * lhs;
+}
 
 template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-uint256_t operator*(const T & lhs, const uint256_t & rhs) {
+constexpr uint256_t operator*(const T & lhs, const uint256_t & rhs) {
     return rhs * lhs;
 }
 
-UINT256_T_EXTERN uint128_t & operator*=(uint128_t & lhs, const uint256_t & rhs);
+constexpr uint128_t & operator*=(uint128_t & lhs, const uint256_t & rhs) {
+    lhs = (rhs * lhs).lower();
+    return lhs;
+}
 
 template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-T & operator*=(T & lhs, const uint256_t & rhs) {
+constexpr T & operator*=(T & lhs, const uint256_t & rhs) {
     return lhs = static_cast <T> (rhs * lhs);
 }
 
-UINT256_T_EXTERN uint256_t operator/(const uint128_t & lhs, const uint256_t & rhs);
+constexpr uint256_t operator/(const uint128_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) / rhs;
+}
 
 template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-uint256_t operator/(const T & lhs, const uint256_t & rhs) {
+constexpr uint256_t operator/(const T & lhs, const uint256_t & rhs) {
     return uint256_t(lhs) / rhs;
 }
 
-UINT256_T_EXTERN uint128_t & operator/=(uint128_t & lhs, const uint256_t & rhs);
+constexpr uint128_t & operator/=(uint128_t & lhs, const uint256_t & rhs) {
+    lhs = (uint256_t(lhs) / rhs).lower();
+    return lhs;
+}
 
 template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-T & operator/=(T & lhs, const uint256_t & rhs) {
+constexpr T & operator/=(T & lhs, const uint256_t & rhs) {
     return lhs = static_cast <T> (uint256_t(lhs) / rhs);
 }
 
-UINT256_T_EXTERN uint256_t operator%(const uint128_t & lhs, const uint256_t & rhs);
+constexpr uint256_t operator%(const uint128_t & lhs, const uint256_t & rhs) {
+    return uint256_t(lhs) % rhs;
+}
 
 template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-uint256_t operator%(const T & lhs, const uint256_t & rhs) {
+constexpr uint256_t operator%(const T & lhs, const uint256_t & rhs) {
     return uint256_t(lhs) % rhs;
 }
 
-UINT256_T_EXTERN uint128_t & operator%=(uint128_t & lhs, const uint256_t & rhs);
+constexpr uint128_t & operator%=(uint128_t & lhs, const uint256_t & rhs) {
+    lhs = (uint256_t(lhs) % rhs).lower();
+    return lhs;
+}
 
 template <typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type >
-T & operator%=(T & lhs, const uint256_t & rhs) {
+constexpr T & operator%=(T & lhs, const uint256_t & rhs) {
     return lhs = static_cast <T> (uint256_t(lhs) % rhs);
 }
 
+// Bit counting, mirroring <bit>
+constexpr int countl_zero(const uint256_t & x) {
+    if (x.upper().upper()) {
+        return std::countl_zero(x.upper().upper());
+    } else if (x.upper().lower()) {
+        return 64 + std::countl_zero(x.upper().lower());
+    } else if (x.lower().upper()) {
+        return 128 + std::countl_zero(x.lower().upper());
+    }
+    return 192 + std::countl_zero(x.lower().lower());
+}
+
+constexpr int countl_one(const uint256_t & x) {
+    return countl_zero(~x);
+}
+
+constexpr int countr_zero(const uint256_t & x) {
+    if (x.lower().lower()) {
+        return std::countr_zero(x.lower().lower());
+    } else if (x.lower().upper()) {
+        return 64 + std::countr_zero(x.lower().upper());
+    } else if (x.upper().lower()) {
+        return 128 + std::countr_zero(x.upper().lower());
+    }
+    return 192 + std::countr_zero(x.upper().upper());
+}
+
+constexpr int countr_one(const uint256_t & x) {
+    return countr_zero(~x);
+}
+
+constexpr int popcount(const uint256_t & x) {
+    return std::popcount(x.upper().upper()) + std::popcount(x.upper().lower()) +
+           std::popcount(x.lower().upper()) + std::popcount(x.lower().lower());
+}
+
+constexpr int bit_width(const uint256_t & x) {
+    return 256 - countl_zero(x);
+}
+
+constexpr bool has_single_bit(const uint256_t & x) {
+    return popcount(x) == 1;
+}
+
+constexpr uint256_t rotl(const uint256_t & x, const int s) {
+    // unsigned wrap of a negative count is a multiple of 256 away, so it rotates right
+    const unsigned int r = (unsigned int)s % 256;
+    return (x << r) | (x >> ((256 - r) % 256));
+}
+
+constexpr uint256_t rotr(const uint256_t & x, const int s) {
+    const unsigned int r = (unsigned int)s % 256;
+    return (x >> r) | (x << ((256 - r) % 256));
+}
+
+// Full 512-bit product as {high, low} halves
+constexpr std::pair <uint256_t, uint256_t> mul_wide(const uint256_t & lhs, const uint256_t & rhs) {
+    const std::array<uint64_t, 4> a = { lhs.lower().lower(), lhs.lower().upper(), lhs.upper().lower(), lhs.upper().upper() };
+    const std::array<uint64_t, 4> b = { rhs.lower().lower(), rhs.lower().upper(), rhs.upper().lower(), rhs.upper().upper() };
+    const std::array<uint64_t, 8> r = uint256::detail::mul_full_limbs(a, b);
+    return std::pair <uint256_t, uint256_t>(uint256_t(r[7], r[6], r[5], r[4]), uint256_t(r[3], r[2], r[1], r[0]));
+}
+
+// floor(a * b / c) on the full 512-bit product (a 512 by 256-bit division);
+// throws std::overflow_error when the quotient does not fit in 256 bits
+constexpr uint256_t muldiv(const uint256_t & a, const uint256_t & b, const uint256_t & c) {
+    if (!c) {
+        throw std::domain_error("Error: division or modulus by 0");
+    }
+    const std::array<uint64_t, 4> x = { a.lower().lower(), a.lower().upper(), a.upper().lower(), a.upper().upper() };
+    const std::array<uint64_t, 4> y = { b.lower().lower(), b.lower().upper(), b.upper().lower(), b.upper().upper() };
+    const uint64_t v[4] = { c.lower().lower(), c.lower().upper(), c.upper().lower(), c.upper().upper() };
+    const std::array<uint64_t, 8> u = uint256::detail::mul_full_limbs(x, y);
+
+    const uint256_t high(u[7], u[6], u[5], u[4]);
+    if (high >= c) {
+        throw std::overflow_error("Error: muldiv result does not fit in 256 bits");
+    }
+    if (!high) {
+        return uint256_t(u[3], u[2], u[1], u[0]) / c;
+    }
+
+    int m = 8, n = 4;
+    while (!u[m - 1]) {
+        m--;
+    }
+    while (!v[n - 1]) {
+        n--;
+    }
+    uint64_t q[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    if (n == 1) {
+        uint64_t r = 0;
+        for (int i = m - 1; i >= 0; i--) {
+            q[i] = uint256::detail::div_128_64(r, u[i], v[0], r);
+        }
+    } else {
+        uint64_t r[4];
+        uint256::detail::divmod_knuth(u.data(), m, v, n, q, r);
+    }
+    return uint256_t(q[3], q[2], q[1], q[0]);
+}
+
+// Carry chain primitives for building wider integers out of 256-bit words:
+// a + b + carry_in and a - b - borrow_in with the carry / borrow out of bit 255
+constexpr std::pair <uint256_t, bool> addc(const uint256_t & a, const uint256_t & b, const bool carry_in) {
+    uint64_t carry = carry_in;
+    const uint64_t r0 = uint256::detail::add_carry_64(a.lower().lower(), b.lower().lower(), carry, carry);
+    const uint64_t r1 = uint256::detail::add_carry_64(a.lower().upper(), b.lower().upper(), carry, carry);
+    const uint64_t r2 = uint256::detail::add_carry_64(a.upper().lower(), b.upper().lower(), carry, carry);
+    const uint64_t r3 = uint256::detail::add_carry_64(a.upper().upper(), b.upper().upper(), carry, carry);
+    return std::pair <uint256_t, bool>(uint256_t(r3, r2, r1, r0), carry);
+}
+
+constexpr std::pair <uint256_t, bool> subb(const uint256_t & a, const uint256_t & b, const bool borrow_in) {
+    uint64_t borrow = borrow_in;
+    const uint64_t r0 = uint256::detail::sub_borrow_64(a.lower().lower(), b.lower().lower(), borrow, borrow);
+    const uint64_t r1 = uint256::detail::sub_borrow_64(a.lower().upper(), b.lower().upper(), borrow, borrow);
+    const uint64_t r2 = uint256::detail::sub_borrow_64(a.upper().lower(), b.upper().lower(), borrow, borrow);
+    const uint64_t r3 = uint256::detail::sub_borrow_64(a.upper().upper(), b.upper().upper(), borrow, borrow);
+    return std::pair <uint256_t, bool>(uint256_t(r3, r2, r1, r0), borrow);
+}
+
+// Checked arithmetic: wrapped result and whether the exact result did not fit in 256 bits
+constexpr std::pair <uint256_t, bool> add_overflow(const uint256_t & a, const uint256_t & b) {
+    return addc(a, b, false);
+}
+
+constexpr std::pair <uint256_t, bool> sub_overflow(const uint256_t & a, const uint256_t & b) {
+    return subb(a, b, false);
+}
+
+constexpr std::pair <uint256_t, bool> mul_overflow(const uint256_t & a, const uint256_t & b) {
+    // a product of m and n bit values has m + n - 1 or m + n bits
+    const uint16_t bits = a.bits() + b.bits();
+    if (bits <= 256) {
+        return std::pair <uint256_t, bool>(a * b, false);
+    }
+    if (bits > 257) {
+        return std::pair <uint256_t, bool>(a * b, true);
+    }
+    const std::pair <uint256_t, uint256_t> wide = mul_wide(a, b);
+    return std::pair <uint256_t, bool>(wide.second, (bool) wide.first);
+}
+
+// Saturating arithmetic, clamping to [0, uint256_max] like std::add_sat and friends
+constexpr uint256_t add_sat(const uint256_t & a, const uint256_t & b) {
+    const std::pair <uint256_t, bool> r = add_overflow(a, b);
+    return r.second ? uint256_max : r.first;
+}
+
+constexpr uint256_t sub_sat(const uint256_t & a, const uint256_t & b) {
+    const std::pair <uint256_t, bool> r = sub_overflow(a, b);
+    return r.second ? uint256_0 : r.first;
+}
+
+constexpr uint256_t mul_sat(const uint256_t & a, const uint256_t & b) {
+    const std::pair <uint256_t, bool> r = mul_overflow(a, b);
+    return r.second ? uint256_max : r.first;
+}
+
+// Integer square root, power and logarithms
+
+namespace uint256::detail {
+
+// floor(sqrt(x)) by Newton's iteration from a power of two at or above the root
+constexpr uint64_t isqrt_64(const uint64_t x) {
+    if (x < 2) {
+        return x;
+    }
+    uint64_t r = 1ULL << ((std::bit_width(x) + 1) / 2);
+    for (;;) {
+        const uint64_t next = (r + x / r) >> 1;
+        if (next >= r) {
+            return r;
+        }
+        r = next;
+    }
+}
+
+// 10^0 through 10^77, every power of ten below 2^256
+constexpr std::array<uint256_t, 78> make_pow10_table() {
+    std::array<uint256_t, 78> t{};
+    uint64_t x[4] = { 1, 0, 0, 0 };
+    for (std::size_t i = 0; i < t.size(); i++) {
+        t[i] = uint256_t(x[3], x[2], x[1], x[0]);
+        mul_add_limbs(x, 10, 0);
+    }
+    return t;
+}
+
+inline constexpr std::array<uint256_t, 78> pow10_table = make_pow10_table();
+
+}
+
+// floor(sqrt(x)). The seed is the root of the top 63 or 64 bits scaled back up, which is
+// above the root and already right to 32 bits, so Newton's iteration only needs a couple
+// of divisions before it stops decreasing.
+constexpr uint256_t isqrt(const uint256_t & x) {
+    if (!x.upper() && !x.lower().upper()) {
+        return uint256::detail::isqrt_64(x.lower().lower());
+    }
+    const unsigned int shift = (x.bits() - 63) & ~1u;
+    uint256_t r = uint256_t(uint256::detail::isqrt_64((uint64_t)(x >> shift)) + 1) << (shift / 2);
+    for (;;) {
+        const uint256_t next = (r + x / r) >> 1;
+        if (next >= r) {
+            return r;
+        }
+        r = next;
+    }
+}
+
+// base^exp by squaring: the power modulo 2^256 and whether the exact power overflowed
+constexpr std::pair <uint256_t, bool> ipow(uint256_t base, uint64_t exp) {
+    uint256_t result = uint256_1;
+    // set once base no longer holds the exact square; multiplying it in then overflows too
+    bool overflow = false, wrapped = false;
+    while (exp) {
+        if (exp & 1) {
+            const std::pair <uint256_t, bool> r = mul_overflow(result, base);
+            result = r.first;
+            overflow |= r.second || wrapped;
+        }
+        exp >>= 1;
+        if (exp) {
+            const std::pair <uint256_t, bool> sq = mul_overflow(base, base);
+            base = sq.first;
+            wrapped |= sq.second;
+        }
+    }
+    return std::pair <uint256_t, bool>(result, overflow);
+}
+
+// floor(log2(x)), the index of the highest set bit
+constexpr int log2(const uint256_t & x) {
+    if (!x) {
+        throw std::domain_error("Error: logarithm of 0");
+    }
+    return 255 - countl_zero(x);
+}
+
+// floor(log10(x)): bits * log10(2) is exact or one too high, and a table lookup decides
+constexpr int log10(const uint256_t & x) {
+    if (!x) {
+        throw std::domain_error("Error: logarithm of 0");
+    }
+    const int t = (bit_width(x) * 1233) >> 12;
+    return t - (x < uint256::detail::pow10_table[t]);
+}
+
+// Hashing: two independent multiply-folds over the limb pairs, then one to combine them.
+// hash_value is found by Boost's hash, AbslHashValue by Abseil's, std::hash is specialized below
+constexpr std::size_t hash_value(const uint256_t & x) {
+    const uint64_t a = uint256::detail::fold_mul_64(x.lower().lower() ^ 0xa0761d6478bd642fULL, x.lower().upper() ^ 0xe7037ed1a0b428dbULL);
+    const uint64_t b = uint256::detail::fold_mul_64(x.upper().lower() ^ 0x8ebc6af09c88c6e3ULL, x.upper().upper() ^ 0x589965cc75374cc3ULL);
+    return (std::size_t)uint256::detail::fold_mul_64(a ^ 0xe7037ed1a0b428dbULL, b ^ 0x1d8e4e27c47d124fULL);
+}
+
+template <typename H>
+H AbslHashValue(H state, const uint256_t & x) {
+    return H::combine(std::move(state), x.lower().lower(), x.lower().upper(), x.upper().lower(), x.upper().upper());
+}
+
+namespace std {
+template <> struct hash <uint256_t> {
+    constexpr std::size_t operator()(const uint256_t & x) const noexcept {
+        return hash_value(x);
+    }
+};
+}
+
 // IO Operator
-UINT256_T_EXTERN std::ostream & operator<<(std::ostream & stream, const uint256_t & rhs);
+// Writes value in base [2, 36] to [first, last) without a terminator, like std::to_chars.
+// Returns {last, std::errc::value_too_large} when the buffer is short; 256 chars always suffice.
+constexpr std::to_chars_result to_chars(char * first, char * last, const uint256_t & value, const int base = 10) {
+    if ((base < 2) || (base > 36)) {
+        return { first, std::errc::invalid_argument };
+    }
+    uint64_t x[4] = { value.lower().lower(), value.lower().upper(), value.upper().lower(), value.upper().upper() };
+    char buf[256];
+    char * const end = buf + sizeof(buf);
+    const char * const begin = std::has_single_bit((unsigned int)base)
+        ? uint256::detail::to_chars_pow2(end, x, std::countr_zero((unsigned int)base))
+        : uint256::detail::to_chars_radix(end, x, base);
+    if (last - first < end - begin) {
+        return { last, std::errc::value_too_large };
+    }
+    return { std::copy(begin, (const char *)end, first), std::errc{} };
+}
+
+// Parses digits in base [2, 36] from [first, last) into value, like std::from_chars: no sign,
+// prefix or whitespace is accepted, and value is only written on success. Digits are consumed
+// 19 at a time for decimal (16 for hex) and folded in with one limb multiply-add per chunk.
+constexpr std::from_chars_result from_chars(const char * first, const char * last, uint256_t & value, const int base = 10) {
+    if ((base < 2) || (base > 36)) {
+        return { first, std::errc::invalid_argument };
+    }
+    const bool pow2 = std::has_single_bit((unsigned int)base);
+    const unsigned int shift = std::countr_zero((unsigned int)base);
+    const int chunk = pow2 ? (int)(64 / shift) : uint256::detail::radix_chunk_for(base).digits;
+
+    uint64_t x[4] = { 0, 0, 0, 0 };
+    bool fits = true;
+    const char * p = first;
+    while (p != last) {
+        uint64_t v = 0, m = 1;
+        int count = 0;
+        while ((count < chunk) && (p != last)) {
+            if constexpr (std::endian::native == std::endian::little) {
+                if ((base == 10) && !std::is_constant_evaluated() && (chunk - count >= 8) && (last - p >= 8)) {
+                    uint64_t eight;
+                    if (uint256::detail::parse_8_digits(p, eight)) {
+                        v = v * 100000000 + eight;
+                        m *= 100000000;
+                        p += 8;
+                        count += 8;
+                        continue;
+                    }
+                }
+            }
+            const unsigned int d = uint256::detail::digit_value(*p);
+            if (d >= (unsigned int)base) {
+                break;
+            }
+            v = v * base + d;
+            m *= base;
+            p++;
+            count++;
+        }
+        if (!count) {
+            break;
+        }
+        if (fits) {
+            fits = pow2 ? uint256::detail::shl_or_limbs(x, count * shift, v) : uint256::detail::mul_add_limbs(x, m, v);
+        }
+        if (count < chunk) {
+            break;
+        }
+    }
+
+    if (p == first) {
+        return { first, std::errc::invalid_argument };
+    }
+    if (!fits) {
+        return { p, std::errc::result_out_of_range };
+    }
+    value = uint256_t(x[3], x[2], x[1], x[0]);
+    return { p, std::errc{} };
+}
+
+// 256-bit integer literals, e.g. 0xffffffff00000001_u256 or 1'000'000'000'000'000'000_u256.
+// Follows the built-in prefixes (0x hex, 0b binary, leading 0 octal) and digit separators;
+// out of range or malformed literals fail to compile.
+consteval uint256_t operator""_u256(const char * s) {
+    std::string_view digits(s);
+    uint8_t base = 10;
+    if ((digits.size() > 2) && (digits[0] == '0') && ((digits[1] == 'x') || (digits[1] == 'X'))) {
+        base = 16;
+        digits.remove_prefix(2);
+    } else if ((digits.size() > 2) && (digits[0] == '0') && ((digits[1] == 'b') || (digits[1] == 'B'))) {
+        base = 2;
+        digits.remove_prefix(2);
+    } else if ((digits.size() > 1) && (digits[0] == '0')) {
+        base = 8;
+        digits.remove_prefix(1);
+    }
+    std::string stripped;
+    for (const char c : digits) {
+        if (c != '\'') {
+            stripped += c;
+        }
+    }
+    return uint256_t(stripped, base);
+}
+
+// formats into a stack buffer; width and fill apply as for strings
+inline std::ostream & operator<<(std::ostream & stream, const uint256_t & rhs) {
+    int base = 0;
+    if (stream.flags() & stream.oct) {
+        base = 8;
+    } else if (stream.flags() & stream.dec) {
+        base = 10;
+    } else if (stream.flags() & stream.hex) {
+        base = 16;
+    }
+    if (base) {
+        char buf[256];
+        const std::to_chars_result res = to_chars(buf, buf + sizeof(buf), rhs, base);
+        stream << std::string_view(buf, res.ptr - buf);
+    }
+    return stream;
+}
+
+constexpr uint256_t & uint256_t::operator=(const bool & rhs) {
+    upper_ = 0;
+    lower_ = rhs;
+    return *this;
+}
+
+constexpr uint256_t::operator bool() const {
+    return (bool)(upper_ | lower_);
+}
+
+constexpr uint256_t::operator uint8_t() const {
+    return (uint8_t)lower_;
+}
+
+constexpr uint256_t::operator uint16_t() const {
+    return (uint16_t)lower_;
+}
+
+constexpr uint256_t::operator uint32_t() const {
+    return (uint32_t)lower_;
+}
+
+constexpr uint256_t::operator uint64_t() const {
+    return (uint64_t)lower_;
+}
+
+constexpr uint256_t::operator uint128_t() const {
+    return lower_;
+}
+
+constexpr uint256_t uint256_t::operator&(const uint128_t & rhs) const {
+    return uint256_t(uint128_0, lower_ & rhs);
+}
+
+constexpr uint256_t uint256_t::operator&(const uint256_t & rhs) const {
+    return uint256_t(upper_ & rhs.upper_, lower_ & rhs.lower_);
+}
+
+constexpr uint256_t & uint256_t::operator&=(const uint128_t & rhs) {
+    upper_ = uint128_0;
+    lower_ &= rhs;
+    return *this;
+}
+
+constexpr uint256_t & uint256_t::operator&=(const uint256_t & rhs) {
+    upper_ &= rhs.upper_;
+    lower_ &= rhs.lower_;
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator|(const uint128_t & rhs) const {
+    return uint256_t(upper_, lower_ | rhs);
+}
+
+constexpr uint256_t uint256_t::operator|(const uint256_t & rhs) const {
+    return uint256_t(upper_ | rhs.upper_, lower_ | rhs.lower_);
+}
+
+constexpr uint256_t & uint256_t::operator|=(const uint128_t & rhs) {
+    lower_ |= rhs;
+    return *this;
+}
+
+constexpr uint256_t & uint256_t::operator|=(const uint256_t & rhs) {
+    upper_ |= rhs.upper_;
+    lower_ |= rhs.lower_;
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator^(const uint128_t & rhs) const {
+    return uint256_t(upper_, lower_ ^ rhs);
+}
+
+constexpr uint256_t uint256_t::operator^(const uint256_t & rhs) const {
+    return uint256_t(upper_ ^ rhs.upper_, lower_ ^ rhs.lower_);
+}
+
+constexpr uint256_t & uint256_t::operator^=(const uint128_t & rhs) {
+    lower_ ^= rhs;
+    return *this;
+}
+
+constexpr uint256_t & uint256_t::operator^=(const uint256_t & rhs) {
+    upper_ ^= rhs.upper_;
+    lower_ ^= rhs.lower_;
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator~() const {
+    return uint256_t(~upper_, ~lower_);
+}
+
+constexpr uint256_t uint256_t::operator<<(const unsigned int shift) const {
+    uint64_t x[4] = { lower_.lower(), lower_.upper(), upper_.lower(), upper_.upper() };
+    uint256::detail::shl_limbs(x, shift);
+    return uint256_t(x[3], x[2], x[1], x[0]);
+}
+
+constexpr uint256_t uint256_t::operator<<(const uint128_t & rhs) const {
+    return *this << uint256_t(rhs);
+}
+
+constexpr uint256_t uint256_t::operator<<(const uint256_t & rhs) const {
+    if ((bool)rhs.upper_ || rhs.lower_.upper() || (rhs.lower_.lower() >= 256)) {
+        return uint256_0;
+    }
+    return *this << (unsigned int)rhs.lower_.lower();
+}
+
+constexpr uint256_t & uint256_t::operator<<=(const unsigned int shift) {
+    *this = *this << shift;
+    return *this;
+}
+
+constexpr uint256_t & uint256_t::operator<<=(const uint128_t & shift) {
+    return *this <<= uint256_t(shift);
+}
+
+constexpr uint256_t & uint256_t::operator<<=(const uint256_t & shift) {
+    *this = *this << shift;
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator>>(const unsigned int shift) const {
+    uint64_t x[4] = { lower_.lower(), lower_.upper(), upper_.lower(), upper_.upper() };
+    uint256::detail::shr_limbs(x, shift);
+    return uint256_t(x[3], x[2], x[1], x[0]);
+}
+
+constexpr uint256_t uint256_t::operator>>(const uint128_t & rhs) const {
+    return *this >> uint256_t(rhs);
+}
+
+constexpr uint256_t uint256_t::operator>>(const uint256_t & rhs) const {
+    if ((bool)rhs.upper_ || rhs.lower_.upper() || (rhs.lower_.lower() >= 256)) {
+        return uint256_0;
+    }
+    return *this >> (unsigned int)rhs.lower_.lower();
+}
+
+constexpr uint256_t & uint256_t::operator>>=(const unsigned int shift) {
+    *this = *this >> shift;
+    return *this;
+}
+
+constexpr uint256_t & uint256_t::operator>>=(const uint128_t & shift) {
+    return *this >>= uint256_t(shift);
+}
+
+constexpr uint256_t & uint256_t::operator>>=(const uint256_t & shift) {
+    *this = *this >> shift;
+    return *this;
+}
+
+constexpr bool uint256_t::operator!() const {
+    return !(bool)*this;
+}
+
+constexpr bool uint256_t::operator&&(const uint128_t & rhs) const {
+    return (*this && uint256_t(rhs));
+}
+
+constexpr bool uint256_t::operator&&(const uint256_t & rhs) const {
+    return ((bool)*this && (bool)rhs);
+}
+
+constexpr bool uint256_t::operator||(const uint128_t & rhs) const {
+    return (*this || uint256_t(rhs));
+}
+
+constexpr bool uint256_t::operator||(const uint256_t & rhs) const {
+    return ((bool)*this || (bool)rhs);
+}
+
+constexpr bool uint256_t::operator==(const uint128_t & rhs) const {
+    return !((upper_.upper() | upper_.lower()) | (lower_.upper() ^ rhs.upper()) | (lower_.lower() ^ rhs.lower()));
+}
+
+constexpr bool uint256_t::operator==(const uint256_t & rhs) const {
+    // one combined test instead of a branch per half
+    return !(((lower_.lower() ^ rhs.lower_.lower()) | (lower_.upper() ^ rhs.lower_.upper())) |
+             ((upper_.lower() ^ rhs.upper_.lower()) | (upper_.upper() ^ rhs.upper_.upper())));
+}
+
+constexpr std::strong_ordering uint256_t::operator<=>(const uint128_t & rhs) const {
+    if (upper_.upper() | upper_.lower()) {
+        return std::strong_ordering::greater;
+    }
+    if (lower_.upper() != rhs.upper()) {
+        return lower_.upper() <=> rhs.upper();
+    }
+    return lower_.lower() <=> rhs.lower();
+}
+
+constexpr std::strong_ordering uint256_t::operator<=>(const uint256_t & rhs) const {
+    // the most significant differing limb decides; equal leading limbs are the predictable case
+    if (upper_.upper() != rhs.upper_.upper()) {
+        return upper_.upper() <=> rhs.upper_.upper();
+    }
+    if (upper_.lower() != rhs.upper_.lower()) {
+        return upper_.lower() <=> rhs.upper_.lower();
+    }
+    if (lower_.upper() != rhs.lower_.upper()) {
+        return lower_.upper() <=> rhs.lower_.upper();
+    }
+    return lower_.lower() <=> rhs.lower_.lower();
+}
+
+constexpr uint256_t uint256_t::operator+(const uint128_t & rhs) const {
+    return *this + uint256_t(rhs);
+}
+
+constexpr uint256_t uint256_t::operator+(const uint256_t & rhs) const {
+    return addc(*this, rhs, false).first;
+}
+
+constexpr uint256_t & uint256_t::operator+=(const uint128_t & rhs) {
+    return *this += uint256_t(rhs);
+}
+
+constexpr uint256_t & uint256_t::operator+=(const uint256_t & rhs) {
+    *this = *this + rhs;
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator-(const uint128_t & rhs) const {
+    return *this - uint256_t(rhs);
+}
+
+constexpr uint256_t uint256_t::operator-(const uint256_t & rhs) const {
+    return subb(*this, rhs, false).first;
+}
+
+constexpr uint256_t & uint256_t::operator-=(const uint128_t & rhs) {
+    return *this -= uint256_t(rhs);
+}
+
+constexpr uint256_t & uint256_t::operator-=(const uint256_t & rhs) {
+    *this = *this - rhs;
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator*(const uint128_t & rhs) const {
+    return *this * uint256_t(rhs);
+}
+
+constexpr uint256_t uint256_t::operator*(const uint256_t & rhs) const {
+    UINT256_PROBE(uint256::instrument::operation::multiply, bits(), rhs.bits());
+    // both operands below 2^64: a single 64 by 64-bit multiply
+    if (!(upper_.upper() | upper_.lower() | lower_.upper() | rhs.upper_.upper() | rhs.upper_.lower() | rhs.lower_.upper())) [[likely]] {
+        uint64_t hi = 0;
+        const uint64_t lo = uint256::detail::mul_add_64(lower_.lower(), rhs.lower_.lower(), 0, 0, hi);
+        return uint256_t(0, 0, hi, lo);
+    }
+#if defined(UINT256_T_NATIVE_MUL)
+    // only the 10 partial products that land below 2^256 are computed
+    const std::array<uint64_t, 4> a = { lower_.lower(), lower_.upper(), upper_.lower(), upper_.upper() };
+    const std::array<uint64_t, 4> b = { rhs.lower_.lower(), rhs.lower_.upper(), rhs.upper_.lower(), rhs.upper_.upper() };
+    const std::array<uint64_t, 4> r = uint256::detail::mul_limbs(a, b);
+
+    return uint256_t(r[3], r[2], r[1], r[0]);
+#else
+    // split values into 4 64-bit parts
+    uint128_t top[4] = { upper_.upper(), upper_.lower(), lower_.upper(), lower_.lower() };
+    uint128_t bottom[4] = { rhs.upper().upper(), rhs.upper().lower(), rhs.lower().upper(), rhs.lower().lower() };
+    uint128_t products[4][4];
+
+    // multiply each component of the values
+    for (int y = 3; y > -1; y--) {
+        for (int x = 3; x > -1; x--) {
+            products[3 - y][x] = top[x] * bottom[y];
+        }
+    }
+
+    // first row
+    uint128_t fourth64 = uint128_t(products[0][3].lower());
+    uint128_t third64 = uint128_t(products[0][2].lower()) + uint128_t(products[0][3].upper());
+    uint128_t second64 = uint128_t(products[0][1].lower()) + uint128_t(products[0][2].upper());
+    uint128_t first64 = uint128_t(products[0][0].lower()) + uint128_t(products[0][1].upper());
+
+    // second row
+    third64 += uint128_t(products[1][3].lower());
+    second64 += uint128_t(products[1][2].lower()) + uint128_t(products[1][3].upper());
+    first64 += uint128_t(products[1][1].lower()) + uint128_t(products[1][2].upper());
+
+    // third row
+    second64 += uint128_t(products[2][3].lower());
+    first64 += uint128_t(products[2][2].lower()) + uint128_t(products[2][3].upper());
+
+    // fourth row
+    first64 += uint128_t(products[3][3].lower());
+
+    // combines the values, taking care of carry over
+    return uint256_t(first64 << uint128_64, uint128_0) +
+        uint256_t(third64.upper(), third64 << uint128_64) +
+        uint256_t(second64, uint128_0) +
+        uint256_t(fourth64);
+#endif
+}
+
+constexpr uint256_t & uint256_t::operator*=(const uint128_t & rhs) {
+    return *this *= uint256_t(rhs);
+}
+
+constexpr uint256_t & uint256_t::operator*=(const uint256_t & rhs) {
+    *this = *this * rhs;
+    return *this;
+}
+
+constexpr std::pair <uint256_t, uint256_t> uint256_t::divmod(const uint256_t & lhs, const uint256_t & rhs) {
+    UINT256_PROBE(uint256::instrument::operation::divmod, lhs.bits(), rhs.bits());
+    // Save some calculations /////////////////////
+    if (rhs == uint256_0) {
+        throw std::domain_error("Error: division or modulus by 0");
+    } else if (rhs == uint256_1) {
+        return std::pair <uint256_t, uint256_t>(lhs, uint256_0);
+    } else if (lhs == rhs) {
+        return std::pair <uint256_t, uint256_t>(uint256_1, uint256_0);
+    } else if ((lhs == uint256_0) || (lhs < rhs)) {
+        return std::pair <uint256_t, uint256_t>(uint256_0, lhs);
+    }
+
+    // dividends that fit the hardware (or compiler) division need no limb loop
+    if (!(lhs.upper_.upper() | lhs.upper_.lower() | lhs.lower_.upper())) [[likely]] {
+        const uint64_t a = lhs.lower_.lower(), b = rhs.lower_.lower();
+        return std::pair <uint256_t, uint256_t>(uint256_t(a / b), uint256_t(a % b));
+    }
+#if defined(__SIZEOF_INT128__)
+    if (!(lhs.upper_.upper() | lhs.upper_.lower())) {
+        const unsigned __int128 a = ((unsigned __int128)lhs.lower_.upper() << 64) | lhs.lower_.lower();
+        const unsigned __int128 b = ((unsigned __int128)rhs.lower_.upper() << 64) | rhs.lower_.lower();
+        const unsigned __int128 q = a / b, r = a % b;
+        return std::pair <uint256_t, uint256_t>(uint256_t(0, 0, (uint64_t)(q >> 64), (uint64_t)q),
+                                                uint256_t(0, 0, (uint64_t)(r >> 64), (uint64_t)r));
+    }
+#endif
+
+    const int n = (rhs.bits() + 63) / 64;
+    if (n == 1) {
+        const std::pair <uint256_t, uint64_t> qr = divmod(lhs, rhs.lower_.lower());
+        return std::pair <uint256_t, uint256_t>(qr.first, uint256_t(qr.second));
+    }
+
+    const uint64_t u[4] = { lhs.lower_.lower(), lhs.lower_.upper(), lhs.upper_.lower(), lhs.upper_.upper() };
+    const uint64_t v[4] = { rhs.lower_.lower(), rhs.lower_.upper(), rhs.upper_.lower(), rhs.upper_.upper() };
+    const int m = (lhs.bits() + 63) / 64;
+    uint64_t q[4] = { 0, 0, 0, 0 };
+    uint64_t r[4] = { 0, 0, 0, 0 };
+    uint256::detail::divmod_knuth(u, m, v, n, q, r);
+
+    return std::pair <uint256_t, uint256_t>(uint256_t(q[3], q[2], q[1], q[0]), uint256_t(r[3], r[2], r[1], r[0]));
+}
+
+constexpr std::pair <uint256_t, uint128_t> uint256_t::divmod(const uint256_t & lhs, const uint128_t & rhs) {
+    UINT256_PROBE(uint256::instrument::operation::divmod, lhs.bits(), rhs.bits());
+    if (!rhs.upper()) {
+        const std::pair <uint256_t, uint64_t> qr = divmod(lhs, rhs.lower());
+        return std::pair <uint256_t, uint128_t>(qr.first, uint128_t(qr.second));
+    }
+
+    const std::pair <uint256_t, uint256_t> qr = divmod(lhs, uint256_t(rhs));
+    return std::pair <uint256_t, uint128_t>(qr.first, qr.second.lower_);
+}
+
+constexpr std::pair <uint256_t, uint64_t> uint256_t::divmod(const uint256_t & lhs, const uint64_t & rhs) {
+    UINT256_PROBE(uint256::instrument::operation::divmod, lhs.bits(), (unsigned int)std::bit_width(rhs));
+    if (rhs == 0) {
+        throw std::domain_error("Error: division or modulus by 0");
+    }
+
+    if (!(lhs.upper_.upper() | lhs.upper_.lower() | lhs.lower_.upper())) [[likely]] {
+        const uint64_t a = lhs.lower_.lower();
+        return std::pair <uint256_t, uint64_t>(uint256_t(a / rhs), a % rhs);
+    }
+
+    // one hardware division per dividend limb, skipping leading zero limbs
+    const uint64_t u[4] = { lhs.lower_.lower(), lhs.lower_.upper(), lhs.upper_.lower(), lhs.upper_.upper() };
+    uint64_t q[4] = { 0, 0, 0, 0 };
+    uint64_t r = 0;
+    int i = 3;
+    while ((i > 0) && !u[i]) {
+        i--;
+    }
+    for (; i >= 0; i--) {
+        q[i] = uint256::detail::div_128_64(r, u[i], rhs, r);
+    }
+
+    return std::pair <uint256_t, uint64_t>(uint256_t(q[3], q[2], q[1], q[0]), r);
+}
+
+constexpr uint256_t uint256_t::operator/(const uint128_t & rhs) const {
+    return divmod(*this, rhs).first;
+}
+
+constexpr uint256_t uint256_t::operator/(const uint256_t & rhs) const {
+    return divmod(*this, rhs).first;
+}
+
+constexpr uint256_t & uint256_t::operator/=(const uint128_t & rhs) {
+    return *this /= uint256_t(rhs);
+}
+
+constexpr uint256_t & uint256_t::operator/=(const uint256_t & rhs) {
+    *this = *this / rhs;
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator%(const uint128_t & rhs) const {
+    return uint256_t(divmod(*this, rhs).second);
+}
+
+constexpr uint256_t uint256_t::operator%(const uint256_t & rhs) const {
+    return divmod(*this, rhs).second;
+}
+
+constexpr uint256_t & uint256_t::operator%=(const uint128_t & rhs) {
+    return *this %= uint256_t(rhs);
+}
+
+constexpr uint256_t & uint256_t::operator%=(const uint256_t & rhs) {
+    *this = *this % rhs;
+    return *this;
+}
+
+constexpr uint256_t & uint256_t::operator++() {
+    *this += uint256_1;
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator++(int) {
+    uint256_t temp(*this);
+    ++ * this;
+    return temp;
+}
+
+constexpr uint256_t & uint256_t::operator--() {
+    *this -= uint256_1;
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator--(int) {
+    uint256_t temp(*this);
+    -- * this;
+    return temp;
+}
+
+constexpr uint256_t uint256_t::operator+() const {
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator-() const {
+    return ~*this + uint256_1;
+}
+
+constexpr const uint128_t & uint256_t::upper() const {
+    return upper_;
+}
+
+constexpr const uint128_t & uint256_t::lower() const {
+    return lower_;
+}
+
+constexpr void uint256_t::to_bytes_be(std::span<std::byte, 32> out) const {
+    uint256::detail::store_limb(out.data(),      uint256::detail::to_big_endian(upper_.upper()));
+    uint256::detail::store_limb(out.data() + 8,  uint256::detail::to_big_endian(upper_.lower()));
+    uint256::detail::store_limb(out.data() + 16, uint256::detail::to_big_endian(lower_.upper()));
+    uint256::detail::store_limb(out.data() + 24, uint256::detail::to_big_endian(lower_.lower()));
+}
+
+constexpr void uint256_t::to_bytes_le(std::span<std::byte, 32> out) const {
+    uint256::detail::store_limb(out.data(),      uint256::detail::to_little_endian(lower_.lower()));
+    uint256::detail::store_limb(out.data() + 8,  uint256::detail::to_little_endian(lower_.upper()));
+    uint256::detail::store_limb(out.data() + 16, uint256::detail::to_little_endian(upper_.lower()));
+    uint256::detail::store_limb(out.data() + 24, uint256::detail::to_little_endian(upper_.upper()));
+}
+
+constexpr std::array<std::byte, 32> uint256_t::to_bytes_be() const {
+    std::array<std::byte, 32> out;
+    to_bytes_be(out);
+    return out;
+}
+
+constexpr std::array<std::byte, 32> uint256_t::to_bytes_le() const {
+    std::array<std::byte, 32> out;
+    to_bytes_le(out);
+    return out;
+}
+
+constexpr uint256_t uint256_t::from_bytes_be(std::span<const std::byte, 32> in) {
+    return uint256_t(uint256::detail::to_big_endian(uint256::detail::load_limb(in.data())),
+                     uint256::detail::to_big_endian(uint256::detail::load_limb(in.data() + 8)),
+                     uint256::detail::to_big_endian(uint256::detail::load_limb(in.data() + 16)),
+                     uint256::detail::to_big_endian(uint256::detail::load_limb(in.data() + 24)));
+}
+
+constexpr uint256_t uint256_t::from_bytes_le(std::span<const std::byte, 32> in) {
+    return uint256_t(uint256::detail::to_little_endian(uint256::detail::load_limb(in.data() + 24)),
+                     uint256::detail::to_little_endian(uint256::detail::load_limb(in.data() + 16)),
+                     uint256::detail::to_little_endian(uint256::detail::load_limb(in.data() + 8)),
+                     uint256::detail::to_little_endian(uint256::detail::load_limb(in.data())));
+}
+
+constexpr std::vector<uint8_t> uint256_t::export_bits() const {
+    UINT256_PROBE(uint256::instrument::operation::export_bits, bits());
+    const std::array<std::byte, 32> bytes = to_bytes_be();
+    std::vector<uint8_t> ret(32);
+    for (int i = 0; i < 32; i++) {
+        ret[i] = (uint8_t)bytes[i];
+    }
+    return ret;
+}
+
+constexpr std::vector<uint8_t> uint256_t::export_bits_truncate() const {
+    UINT256_PROBE(uint256::instrument::operation::export_bits, bits());
+    const std::array<std::byte, 32> bytes = to_bytes_be();
+
+    //prune the zeroes
+    int i = 0;
+    while (i < 32 && bytes[i] == std::byte{ 0 }) i++;
+
+    std::vector<uint8_t> ret(32 - i);
+    for (int j = i; j < 32; j++) {
+        ret[j - i] = (uint8_t)bytes[j];
+    }
+    return ret;
+}
+
+constexpr uint16_t uint256_t::bits() const {
+    return (uint16_t)bit_width(*this);
+}
+
+constexpr void uint256_t::init_from_base(std::string_view const s, uint8_t const base) {
+    UINT256_PROBE(uint256::instrument::operation::init_from_base);
+    if ((base < 2) || (base > 36)) {
+        throw std::invalid_argument("Base must be in the range 2-36");
+    }
+    *this = 0;
+    if (s.empty()) {
+        return;
+    }
+    const std::from_chars_result res = from_chars(s.data(), s.data() + s.size(), *this, base);
+    if (res.ec == std::errc::result_out_of_range) {
+        throw std::out_of_range("Value does not fit in 256 bits");
+    }
+    if ((res.ec != std::errc{}) || (res.ptr != s.data() + s.size())) {
+        throw std::invalid_argument("Invalid character in string");
+    }
+    UINT256_PROBE_OPERAND(bits());
+}
+
+constexpr std::string uint256_t::str(uint8_t base, const unsigned int & len) const {
+    UINT256_PROBE(uint256::instrument::operation::str, bits());
+    if ((base < 2) || (base > 36)) {
+        throw std::invalid_argument("Base must be in the range 2-36");
+    }
+    char buf[256];
+    const std::to_chars_result res = to_chars(buf, buf + sizeof(buf), *this, base);
+    std::string out(buf, res.ptr);
+    if (out.size() < len) {
+        out.insert(0, len - out.size(), '0');
+    }
+    return out;
+}
 #endif
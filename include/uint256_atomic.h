@@ -0,0 +1,245 @@
+/*
+uint256_atomic.h
+Aligned storage and atomic access for uint256_t
+
+uint256_aligned_t is a uint256_t on a 32-byte boundary, for arrays and ring buffers that
+are read with aligned vector loads or must not straddle cache lines. uint256_t itself keeps
+the alignment of uint128_t so that existing structures do not change layout.
+
+uint256_atomic holds one value that many threads load, store and update. No x86 or ARM
+instruction moves or compares 32 bytes atomically (AVX loads and stores may tear, and
+cmpxchg16b covers only half a value), so it is a sequence lock: a writer makes the sequence
+number odd, writes the four limbs and makes it even again; a reader copies the limbs and
+retries if the sequence was odd or changed meanwhile. Loads never write shared memory, so
+readers do not slow each other down. Writers take turns on the sequence number, and every
+read-modify-write runs inside one writer section instead of a compare-and-swap loop.
+
+Writers spin rather than block: a writer preempted inside its section stalls the others
+until it runs again, so is_lock_free() is false. Waiters pause and, after a while, yield.
+Every operation acts on the value as a whole; loads have acquire and stores release
+semantics, as if a lock were held.
+
+    uint256_atomic volume;
+    (void)volume.fetch_add(fill);    // any thread; uint256_t results are [[nodiscard]]
+    const uint256_t v = volume.load();
+*/
+
+#if !defined(__UINT256_ATOMIC__)
+#define __UINT256_ATOMIC__
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#   include <immintrin.h>
+#   define UINT256_ATOMIC_PAUSE() _mm_pause()
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__aarch64__) || defined(__arm__))
+#   define UINT256_ATOMIC_PAUSE() __asm__ __volatile__("yield")
+#else
+#   define UINT256_ATOMIC_PAUSE() ((void)0)
+#endif
+
+#include "uint256.h"
+
+// uint256_t aligned to 32 bytes; converts to and from uint256_t implicitly
+class alignas(32) uint256_aligned_t : public uint256_t {
+public:
+    using uint256_t::uint256_t;
+
+    uint256_aligned_t() = default;
+
+    constexpr uint256_aligned_t(const uint256_t & value)
+        : uint256_t(value)
+    {}
+};
+
+static_assert(sizeof(uint256_aligned_t) == 32, "uint256_aligned_t must not be padded");
+static_assert(alignof(uint256_aligned_t) == 32, "uint256_aligned_t must be 32-byte aligned");
+static_assert(std::is_trivially_copyable_v<uint256_aligned_t>, "uint256_aligned_t must be trivially copyable");
+
+namespace uint256::detail {
+
+// one step of a wait: spin politely, then give the writer a chance to run
+inline void atomic_backoff(unsigned int & spins) {
+    if (++spins < 64) {
+        UINT256_ATOMIC_PAUSE();
+    } else {
+        spins = 0;
+        std::this_thread::yield();
+    }
+}
+
+}
+
+// sequence number and limbs share one cache line
+class alignas(64) uint256_atomic {
+public:
+    static constexpr bool is_always_lock_free = false;
+
+    constexpr uint256_atomic()
+        : uint256_atomic(uint256_0)
+    {}
+
+    constexpr uint256_atomic(const uint256_t & value)
+        : limbs_{ value.lower().lower(), value.lower().upper(), value.upper().lower(), value.upper().upper() }
+    {}
+
+    uint256_atomic(const uint256_atomic &) = delete;
+    uint256_atomic & operator=(const uint256_atomic &) = delete;
+
+    bool is_lock_free() const {
+        return false;
+    }
+
+    uint256_t load() const {
+        for (unsigned int spins = 0;; uint256::detail::atomic_backoff(spins)) {
+            const uint64_t before = sequence_.load(std::memory_order_acquire);
+            if (before & 1) {
+                continue;
+            }
+            const uint256_t value = read();
+            // keeps the limb loads above the second sequence load
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence_.load(std::memory_order_relaxed) == before) {
+                return value;
+            }
+        }
+    }
+
+    void store(const uint256_t & value) {
+        const uint64_t sequence = lock();
+        write(value);
+        unlock(sequence);
+    }
+
+    uint256_t exchange(const uint256_t & value) {
+        return update([&](const uint256_t &) {
+            return value;
+        });
+    }
+
+    // on failure, expected is set to the current value
+    bool compare_exchange_strong(uint256_t & expected, const uint256_t & desired) {
+        // a mismatch seen by a plain load fails without taking the writer's turn
+        const uint256_t seen = load();
+        if (seen != expected) {
+            expected = seen;
+            return false;
+        }
+        const uint64_t sequence = lock();
+        const uint256_t current = read();
+        const bool equal = current == expected;
+        if (equal) {
+            write(desired);
+        } else {
+            expected = current;
+        }
+        unlock(sequence);
+        return equal;
+    }
+
+    // never fails spuriously
+    bool compare_exchange_weak(uint256_t & expected, const uint256_t & desired) {
+        return compare_exchange_strong(expected, desired);
+    }
+
+    // these return the previous value and wrap like uint256_t arithmetic
+    uint256_t fetch_add(const uint256_t & value) {
+        return update([&](const uint256_t & current) {
+            return current + value;
+        });
+    }
+
+    uint256_t fetch_sub(const uint256_t & value) {
+        return update([&](const uint256_t & current) {
+            return current - value;
+        });
+    }
+
+    uint256_t fetch_and(const uint256_t & value) {
+        return update([&](const uint256_t & current) {
+            return current & value;
+        });
+    }
+
+    uint256_t fetch_or(const uint256_t & value) {
+        return update([&](const uint256_t & current) {
+            return current | value;
+        });
+    }
+
+    uint256_t fetch_xor(const uint256_t & value) {
+        return update([&](const uint256_t & current) {
+            return current ^ value;
+        });
+    }
+
+    // applies f to the current value and stores the result; f runs inside the writer's
+    // section, so it should be short and must not touch this object
+    template <typename F>
+    uint256_t update(const F & f) {
+        const uint64_t sequence = lock();
+        const uint256_t current = read();
+        write(f(current));
+        unlock(sequence);
+        return current;
+    }
+
+    operator uint256_t() const {
+        return load();
+    }
+
+    uint256_t operator=(const uint256_t & value) {
+        store(value);
+        return value;
+    }
+
+    uint256_t operator+=(const uint256_t & value) {
+        return fetch_add(value) + value;
+    }
+
+    uint256_t operator-=(const uint256_t & value) {
+        return fetch_sub(value) - value;
+    }
+
+private:
+    // waits for an even sequence number and makes it odd; returns the even value
+    uint64_t lock() {
+        uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+        for (unsigned int spins = 0;; uint256::detail::atomic_backoff(spins)) {
+            if (!(sequence & 1) && sequence_.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                break;
+            }
+            sequence = sequence_.load(std::memory_order_relaxed);
+        }
+        // a reader that sees any of the following limb stores also sees the odd number
+        std::atomic_thread_fence(std::memory_order_release);
+        return sequence;
+    }
+
+    void unlock(const uint64_t sequence) {
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    uint256_t read() const {
+        return uint256_t(limbs_[3].load(std::memory_order_relaxed), limbs_[2].load(std::memory_order_relaxed),
+                         limbs_[1].load(std::memory_order_relaxed), limbs_[0].load(std::memory_order_relaxed));
+    }
+
+    void write(const uint256_t & value) {
+        limbs_[0].store(value.lower().lower(), std::memory_order_relaxed);
+        limbs_[1].store(value.lower().upper(), std::memory_order_relaxed);
+        limbs_[2].store(value.upper().lower(), std::memory_order_relaxed);
+        limbs_[3].store(value.upper().upper(), std::memory_order_relaxed);
+    }
+
+    std::atomic<uint64_t> sequence_{ 0 };
+    // least significant first
+    std::atomic<uint64_t> limbs_[4];
+};
+
+#endif
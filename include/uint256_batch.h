@@ -0,0 +1,382 @@
+/*
+uint256_batch.h
+Elementwise and reduction kernels over spans of uint256_t
+
+The SIMD kernels work on the array-of-structures layout directly: each uint256_t is
+four 64-bit lanes of one AVX2 register (two elements per AVX-512 register), and carries
+or borrows between lanes are resolved on the comparison bit masks instead of transposing
+into per-limb columns. Comparisons, min and max stay scalar on every instruction set:
+they mostly resolve on the top limb, and neither the per-element masks nor a transposed
+compare beat that. ISA selection happens once at runtime; compilers without target
+attributes and non-x86 builds use the scalar loops throughout.
+*/
+
+#if !defined(__UINT256_BATCH__)
+#define __UINT256_BATCH__
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+#include "uint256.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#   include <immintrin.h>
+#   define UINT256_T_BATCH_DISPATCH
+#   define UINT256_T_TARGET_AVX2   __attribute__((target("avx2")))
+#   define UINT256_T_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+namespace uint256 {
+
+enum class batch_isa {
+    scalar,
+    avx2,
+    avx512,
+};
+
+}
+
+namespace uint256::detail {
+
+// kernel entry points for one instruction set; n elements, out may alias a or b
+struct batch_kernels {
+    void (*add)(const uint256_t * a, const uint256_t * b, uint256_t * out, std::size_t n);
+    void (*sub)(const uint256_t * a, const uint256_t * b, uint256_t * out, std::size_t n);
+    void (*equal)(const uint256_t * a, const uint256_t * b, bool * out, std::size_t n);
+    void (*less)(const uint256_t * a, const uint256_t * b, bool * out, std::size_t n);
+    void (*min)(const uint256_t * a, const uint256_t * b, uint256_t * out, std::size_t n);
+    void (*max)(const uint256_t * a, const uint256_t * b, uint256_t * out, std::size_t n);
+    std::pair<uint256_t, uint64_t> (*sum)(const uint256_t * a, std::size_t n);
+};
+
+inline void add_scalar(const uint256_t * a, const uint256_t * b, uint256_t * out, const std::size_t n) {
+    for (std::size_t i = 0; i < n; i++) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+inline void sub_scalar(const uint256_t * a, const uint256_t * b, uint256_t * out, const std::size_t n) {
+    for (std::size_t i = 0; i < n; i++) {
+        out[i] = a[i] - b[i];
+    }
+}
+
+inline void equal_scalar(const uint256_t * a, const uint256_t * b, bool * out, const std::size_t n) {
+    for (std::size_t i = 0; i < n; i++) {
+        out[i] = a[i] == b[i];
+    }
+}
+
+inline void less_scalar(const uint256_t * a, const uint256_t * b, bool * out, const std::size_t n) {
+    for (std::size_t i = 0; i < n; i++) {
+        out[i] = a[i] < b[i];
+    }
+}
+
+inline void min_scalar(const uint256_t * a, const uint256_t * b, uint256_t * out, const std::size_t n) {
+    for (std::size_t i = 0; i < n; i++) {
+        out[i] = (b[i] < a[i]) ? b[i] : a[i];
+    }
+}
+
+inline void max_scalar(const uint256_t * a, const uint256_t * b, uint256_t * out, const std::size_t n) {
+    for (std::size_t i = 0; i < n; i++) {
+        out[i] = (a[i] < b[i]) ? b[i] : a[i];
+    }
+}
+
+inline std::pair<uint256_t, uint64_t> sum_scalar(const uint256_t * a, const std::size_t n) {
+    uint256_t total = 0;
+    uint64_t carries = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        total += a[i];
+        carries += total < a[i];
+    }
+    return { total, carries };
+}
+
+// 320-bit accumulator (least significant limb first) for the vector sums
+inline void add_at(uint64_t (&t)[5], const uint64_t v, const unsigned int bit) {
+    const unsigned int limb = bit / 64, offset = bit % 64;
+    uint64_t lo = v << offset;
+    uint64_t hi = offset ? (v >> (64 - offset)) : 0;
+    for (unsigned int i = limb; i < 5; i++) {
+        t[i] += lo;
+        hi += t[i] < lo;
+        lo = hi;
+        hi = 0;
+    }
+}
+
+#if defined(UINT256_T_BATCH_DISPATCH)
+
+static_assert(sizeof(uint256_t) == 32, "batch kernels load uint256_t as four adjacent limbs");
+
+// lanes set to all ones where the corresponding bit of mask is set
+UINT256_T_TARGET_AVX2 inline __m256i lanes_avx2(const unsigned int mask) {
+    const __m256i bits = _mm256_setr_epi64x(1, 2, 4, 8);
+    return _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(mask), bits), bits);
+}
+
+// bit k set where lane k of x is above lane k of y, unsigned
+UINT256_T_TARGET_AVX2 inline unsigned int above_avx2(const __m256i x, const __m256i y) {
+    const __m256i sign = _mm256_set1_epi64x((long long)0x8000000000000000ULL);
+    return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(_mm256_xor_si256(x, sign), _mm256_xor_si256(y, sign))));
+}
+
+UINT256_T_TARGET_AVX2 inline unsigned int same_avx2(const __m256i x, const __m256i y) {
+    return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(x, y)));
+}
+
+UINT256_T_TARGET_AVX2 inline void add_avx2(const uint256_t * a, const uint256_t * b, uint256_t * out, const std::size_t n) {
+    const __m256i ones = _mm256_set1_epi64x(-1);
+    for (std::size_t i = 0; i < n; i++) {
+        const __m256i x = _mm256_loadu_si256((const __m256i *)(a + i));
+        const __m256i y = _mm256_loadu_si256((const __m256i *)(b + i));
+        __m256i s = _mm256_add_epi64(x, y);
+        // wrapped limbs generate a carry, all-ones limbs pass an incoming carry on
+        const unsigned int generate = above_avx2(x, s);
+        const unsigned int propagate = same_avx2(s, ones);
+        const unsigned int carry_in = (((generate << 1) + propagate) ^ propagate) & 0xf;
+        s = _mm256_sub_epi64(s, lanes_avx2(carry_in));
+        _mm256_storeu_si256((__m256i *)(out + i), s);
+    }
+}
+
+UINT256_T_TARGET_AVX2 inline void sub_avx2(const uint256_t * a, const uint256_t * b, uint256_t * out, const std::size_t n) {
+    const __m256i zero = _mm256_setzero_si256();
+    for (std::size_t i = 0; i < n; i++) {
+        const __m256i x = _mm256_loadu_si256((const __m256i *)(a + i));
+        const __m256i y = _mm256_loadu_si256((const __m256i *)(b + i));
+        __m256i d = _mm256_sub_epi64(x, y);
+        // limbs below the subtrahend generate a borrow, zero limbs pass an incoming borrow on
+        const unsigned int generate = above_avx2(y, x);
+        const unsigned int propagate = same_avx2(d, zero);
+        const unsigned int borrow_in = (((generate << 1) + propagate) ^ propagate) & 0xf;
+        d = _mm256_add_epi64(d, lanes_avx2(borrow_in));
+        _mm256_storeu_si256((__m256i *)(out + i), d);
+    }
+}
+
+// Limbs are split into 32-bit halves and summed in 64-bit lanes, which cannot overflow
+// within a block of 2^31 elements; each block is folded into the 320-bit total
+inline constexpr std::size_t sum_block = (std::size_t)1 << 31;
+
+UINT256_T_TARGET_AVX2 inline std::pair<uint256_t, uint64_t> sum_avx2(const uint256_t * a, const std::size_t n) {
+    const __m256i low = _mm256_set1_epi64x(0xffffffffLL);
+    uint64_t t[5] = { 0, 0, 0, 0, 0 };
+    for (std::size_t start = 0; start < n; start += sum_block) {
+        const std::size_t end = (n - start < sum_block) ? n : start + sum_block;
+        __m256i lo = _mm256_setzero_si256(), hi = _mm256_setzero_si256();
+        for (std::size_t i = start; i < end; i++) {
+            const __m256i x = _mm256_loadu_si256((const __m256i *)(a + i));
+            lo = _mm256_add_epi64(lo, _mm256_and_si256(x, low));
+            hi = _mm256_add_epi64(hi, _mm256_srli_epi64(x, 32));
+        }
+        alignas(32) uint64_t l[4], h[4];
+        _mm256_store_si256((__m256i *)l, lo);
+        _mm256_store_si256((__m256i *)h, hi);
+        for (unsigned int k = 0; k < 4; k++) {
+            add_at(t, l[k], k * 64);
+            add_at(t, h[k], k * 64 + 32);
+        }
+    }
+    return { uint256_t(t[3], t[2], t[1], t[0]), t[4] };
+}
+
+// AVX-512: two elements per register, limbs 0-3 and 4-7 of each 8-bit compare mask
+
+// resolves carry (or borrow) chains separately for each element's nibble
+constexpr unsigned int ripple_x2(const unsigned int generate, const unsigned int propagate) {
+    const unsigned int g0 = generate & 0xf, g1 = generate >> 4;
+    const unsigned int p0 = propagate & 0xf, p1 = propagate >> 4;
+    return ((((g0 << 1) + p0) ^ p0) & 0xf) | (((((g1 << 1) + p1) ^ p1) & 0xf) << 4);
+}
+
+UINT256_T_TARGET_AVX512 inline void add_avx512(const uint256_t * a, const uint256_t * b, uint256_t * out, const std::size_t n) {
+    const __m512i ones = _mm512_set1_epi64(-1);
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        const __m512i x = _mm512_loadu_si512(a + i);
+        const __m512i y = _mm512_loadu_si512(b + i);
+        const __m512i s = _mm512_add_epi64(x, y);
+        const unsigned int carry_in = ripple_x2(_mm512_cmplt_epu64_mask(s, x), _mm512_cmpeq_epu64_mask(s, ones));
+        _mm512_storeu_si512(out + i, _mm512_mask_sub_epi64(s, (__mmask8)carry_in, s, ones));
+    }
+    add_scalar(a + i, b + i, out + i, n - i);
+}
+
+UINT256_T_TARGET_AVX512 inline void sub_avx512(const uint256_t * a, const uint256_t * b, uint256_t * out, const std::size_t n) {
+    const __m512i ones = _mm512_set1_epi64(-1);
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        const __m512i x = _mm512_loadu_si512(a + i);
+        const __m512i y = _mm512_loadu_si512(b + i);
+        const __m512i d = _mm512_sub_epi64(x, y);
+        const unsigned int borrow_in = ripple_x2(_mm512_cmplt_epu64_mask(x, y), _mm512_cmpeq_epu64_mask(d, _mm512_setzero_si512()));
+        _mm512_storeu_si512(out + i, _mm512_mask_add_epi64(d, (__mmask8)borrow_in, d, ones));
+    }
+    sub_scalar(a + i, b + i, out + i, n - i);
+}
+
+UINT256_T_TARGET_AVX512 inline std::pair<uint256_t, uint64_t> sum_avx512(const uint256_t * a, const std::size_t n) {
+    const __m512i low = _mm512_set1_epi64(0xffffffffLL);
+    uint64_t t[5] = { 0, 0, 0, 0, 0 };
+    const std::size_t pairs = n & ~(std::size_t)1;
+    for (std::size_t start = 0; start < pairs; start += sum_block) {
+        const std::size_t end = (pairs - start < sum_block) ? pairs : start + sum_block;
+        __m512i lo = _mm512_setzero_si512(), hi = _mm512_setzero_si512();
+        for (std::size_t i = start; i < end; i += 2) {
+            const __m512i x = _mm512_loadu_si512(a + i);
+            lo = _mm512_add_epi64(lo, _mm512_and_si512(x, low));
+            // the unmasked shift trips GCC 12's -Wmaybe-uninitialized on its undefined source
+            hi = _mm512_add_epi64(hi, _mm512_maskz_srli_epi64((__mmask8)-1, x, 32));
+        }
+        alignas(64) uint64_t l[8], h[8];
+        _mm512_store_si512(l, lo);
+        _mm512_store_si512(h, hi);
+        for (unsigned int k = 0; k < 8; k++) {
+            add_at(t, l[k], (k % 4) * 64);
+            add_at(t, h[k], (k % 4) * 64 + 32);
+        }
+    }
+    if (pairs != n) {
+        const uint256_t & last = a[pairs];
+        add_at(t, last.lower().lower(), 0);
+        add_at(t, last.lower().upper(), 64);
+        add_at(t, last.upper().lower(), 128);
+        add_at(t, last.upper().upper(), 192);
+    }
+    return { uint256_t(t[3], t[2], t[1], t[0]), t[4] };
+}
+
+#endif
+
+inline const batch_kernels & kernels_for(const batch_isa isa) {
+    static constexpr batch_kernels scalar = { add_scalar, sub_scalar, equal_scalar, less_scalar, min_scalar, max_scalar, sum_scalar };
+#if defined(UINT256_T_BATCH_DISPATCH)
+    static constexpr batch_kernels avx2 = { add_avx2, sub_avx2, equal_scalar, less_scalar, min_scalar, max_scalar, sum_avx2 };
+    static constexpr batch_kernels avx512 = { add_avx512, sub_avx512, equal_scalar, less_scalar, min_scalar, max_scalar, sum_avx512 };
+    switch (isa) {
+        case batch_isa::avx512:
+            return avx512;
+        case batch_isa::avx2:
+            return avx2;
+        default:
+            break;
+    }
+#endif
+    (void)isa;
+    return scalar;
+}
+
+template <typename T>
+void check_sizes(const std::span<const uint256_t> a, const std::span<const uint256_t> b, const std::span<T> out) {
+    if ((a.size() != b.size()) || (a.size() != out.size())) {
+        throw std::invalid_argument("Error: batch spans differ in size");
+    }
+}
+
+}
+
+namespace uint256 {
+
+// whether this CPU (and build) can run the kernels for isa
+inline bool batch_isa_supported(const batch_isa isa) {
+    switch (isa) {
+        case batch_isa::scalar:
+            return true;
+#if defined(UINT256_T_BATCH_DISPATCH)
+        case batch_isa::avx2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+        case batch_isa::avx512:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx512f");
+#endif
+        default:
+            return false;
+    }
+}
+
+// widest supported instruction set, detected on first use
+inline batch_isa active_batch_isa() {
+    static const batch_isa isa = batch_isa_supported(batch_isa::avx512) ? batch_isa::avx512
+                               : batch_isa_supported(batch_isa::avx2)   ? batch_isa::avx2
+                               : batch_isa::scalar;
+    return isa;
+}
+
+// Elementwise operations; all spans must have the same size and out may alias a or b
+
+// out[i] = a[i] + b[i] (mod 2^256)
+inline void add(const std::span<const uint256_t> a, const std::span<const uint256_t> b, const std::span<uint256_t> out) {
+    detail::check_sizes(a, b, out);
+    detail::kernels_for(active_batch_isa()).add(a.data(), b.data(), out.data(), out.size());
+}
+
+// out[i] = a[i] - b[i] (mod 2^256)
+inline void sub(const std::span<const uint256_t> a, const std::span<const uint256_t> b, const std::span<uint256_t> out) {
+    detail::check_sizes(a, b, out);
+    detail::kernels_for(active_batch_isa()).sub(a.data(), b.data(), out.data(), out.size());
+}
+
+// out[i] = a[i] == b[i]
+inline void equal(const std::span<const uint256_t> a, const std::span<const uint256_t> b, const std::span<bool> out) {
+    detail::check_sizes(a, b, out);
+    detail::kernels_for(active_batch_isa()).equal(a.data(), b.data(), out.data(), out.size());
+}
+
+// out[i] = a[i] < b[i]
+inline void less(const std::span<const uint256_t> a, const std::span<const uint256_t> b, const std::span<bool> out) {
+    detail::check_sizes(a, b, out);
+    detail::kernels_for(active_batch_isa()).less(a.data(), b.data(), out.data(), out.size());
+}
+
+inline void min(const std::span<const uint256_t> a, const std::span<const uint256_t> b, const std::span<uint256_t> out) {
+    detail::check_sizes(a, b, out);
+    detail::kernels_for(active_batch_isa()).min(a.data(), b.data(), out.data(), out.size());
+}
+
+inline void max(const std::span<const uint256_t> a, const std::span<const uint256_t> b, const std::span<uint256_t> out) {
+    detail::check_sizes(a, b, out);
+    detail::kernels_for(active_batch_isa()).max(a.data(), b.data(), out.data(), out.size());
+}
+
+// Reductions
+
+// full sum: the low 256 bits, and the bits above them
+inline std::pair<uint256_t, uint64_t> sum(const std::span<const uint256_t> a) {
+    return detail::kernels_for(active_batch_isa()).sum(a.data(), a.size());
+}
+
+// smallest element, uint256_max for an empty span
+inline uint256_t min(const std::span<const uint256_t> a) {
+    uint256_t m = uint256_max;
+    for (const uint256_t & x : a) {
+        if (x < m) {
+            m = x;
+        }
+    }
+    return m;
+}
+
+// largest element, 0 for an empty span
+inline uint256_t max(const std::span<const uint256_t> a) {
+    uint256_t m = uint256_0;
+    for (const uint256_t & x : a) {
+        if (m < x) {
+            m = x;
+        }
+    }
+    return m;
+}
+
+}
+
+#endif
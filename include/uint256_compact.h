@@ -0,0 +1,274 @@
+/*
+uint256_compact.h
+Variable-length byte encodings for mostly small uint256_t values
+
+LEB128: 7 bits per byte, least significant group first, the high bit set on every byte
+but the last. 0 is one byte, values below 2^64 take at most 10 and 2^256 - 1 takes 37.
+
+RLP (as used by Ethereum for integers): values below 0x80 are the byte itself, anything
+else is 0x80 + n followed by the n significant big endian bytes; 0 is 0x80.
+
+Both sizes come straight from bits(), values that fit in one limb take a 64-bit path,
+and everything writes into caller buffers like std::to_chars: on value_too_large nothing
+is written past last. Decoders write the value only on success and fail with
+invalid_argument for truncated input and result_out_of_range for values above 256 bits.
+The RLP decoder also rejects non-canonical input with invalid_argument; the LEB128
+decoder accepts zero padding, like most LEB128 readers, as long as the encoding is no
+longer than leb128_max_size. The span overloads handle whole arrays back to back.
+
+    std::byte buf[37];
+    const uint256::encode_result res = uint256::encode_leb128(buf, buf + sizeof(buf), balance);
+*/
+
+#if !defined(__UINT256_COMPACT__)
+#define __UINT256_COMPACT__
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <system_error>
+
+#include "uint256.h"
+
+namespace uint256 {
+
+struct encode_result {
+    std::byte * ptr;
+    std::errc ec;
+};
+
+struct decode_result {
+    const std::byte * ptr;
+    std::errc ec;
+};
+
+inline constexpr std::size_t leb128_max_size = 37;
+inline constexpr std::size_t rlp_max_size = 33;
+
+constexpr std::size_t leb128_size(const uint256_t & value) {
+    const std::size_t bits = value.bits();
+    return bits ? (bits + 6) / 7 : 1;
+}
+
+constexpr std::size_t rlp_size(const uint256_t & value) {
+    const std::size_t bits = value.bits();
+    return (bits <= 7) ? 1 : (1 + (bits + 7) / 8);
+}
+
+constexpr encode_result encode_leb128(std::byte * first, std::byte * const last, const uint256_t & value) {
+    const std::size_t size = leb128_size(value);
+    if ((std::size_t)(last - first) < size) {
+        return { last, std::errc::value_too_large };
+    }
+    if (!value.upper() && !value.lower().upper()) [[likely]] {
+        uint64_t v = value.lower().lower();
+        while (v >= 0x80) {
+            *first++ = (std::byte)(v | 0x80);
+            v >>= 7;
+        }
+        *first++ = (std::byte)v;
+        return { first, std::errc{} };
+    }
+    const uint64_t x[4] = { value.lower().lower(), value.lower().upper(), value.upper().lower(), value.upper().upper() };
+    for (std::size_t i = 0; i < size; i += 8) {
+        // eight groups from the 56 bits at 7i, which may straddle two limbs
+        const std::size_t p = 7 * i, limb = p / 64, o = p % 64;
+        uint64_t v = x[limb] >> o;
+        if (o && (limb < 3)) {
+            v |= x[limb + 1] << (64 - o);
+        }
+        const std::size_t n = (size - i < 8) ? (size - i) : 8;
+        for (std::size_t j = 0; j < n; j++) {
+            first[j] = (std::byte)(((v >> (7 * j)) & 0x7f) | 0x80);
+        }
+        first += n;
+    }
+    first[-1] &= std::byte{ 0x7f };
+    return { first, std::errc{} };
+}
+
+constexpr decode_result decode_leb128(const std::byte * const first, const std::byte * const last, uint256_t & value) {
+    const std::byte * p = first;
+
+    // up to 9 bytes fill 63 bits without straddling a limb
+    uint64_t v = 0;
+    for (unsigned int shift = 0; (shift < 63) && (p != last); shift += 7) {
+        const uint64_t b = (uint64_t)*p++;
+        v |= (b & 0x7f) << shift;
+        if (!(b & 0x80)) [[likely]] {
+            value = v;
+            return { p, std::errc{} };
+        }
+    }
+
+    uint64_t x[4] = { v, 0, 0, 0 };
+    for (std::size_t pos = 63; p != last; pos += 7) {
+        const uint64_t b = (uint64_t)*p++;
+        const uint64_t group = b & 0x7f;
+        if (pos >= 256) {
+            if (group) {
+                return { first, std::errc::result_out_of_range };
+            }
+        } else {
+            const std::size_t limb = pos / 64, o = pos % 64;
+            x[limb] |= group << o;
+            if ((o > 57) && (limb < 3)) {
+                x[limb + 1] |= group >> (64 - o);
+            } else if ((o > 57) && (group >> (64 - o))) {
+                return { first, std::errc::result_out_of_range };
+            }
+        }
+        if (!(b & 0x80)) {
+            value = uint256_t(x[3], x[2], x[1], x[0]);
+            return { p, std::errc{} };
+        }
+        // zero padding is allowed, but not past the longest encoding
+        if ((std::size_t)(p - first) >= leb128_max_size) {
+            return { first, std::errc::result_out_of_range };
+        }
+    }
+    return { first, std::errc::invalid_argument };
+}
+
+constexpr encode_result encode_rlp(std::byte * first, std::byte * const last, const uint256_t & value) {
+    const std::size_t size = rlp_size(value);
+    if ((std::size_t)(last - first) < size) {
+        return { last, std::errc::value_too_large };
+    }
+    if (size == 1) {
+        *first++ = value ? (std::byte)value.lower().lower() : std::byte{ 0x80 };
+        return { first, std::errc{} };
+    }
+    const std::size_t n = size - 1;
+    *first++ = (std::byte)(0x80 + n);
+    if (!value.upper() && !value.lower().upper()) [[likely]] {
+        const uint64_t v = value.lower().lower();
+        for (std::size_t i = n; i > 0; i--) {
+            *first++ = (std::byte)(v >> (8 * (i - 1)));
+        }
+        return { first, std::errc{} };
+    }
+    const std::array<std::byte, 32> bytes = value.to_bytes_be();
+    for (std::size_t i = 32 - n; i < 32; i++) {
+        *first++ = bytes[i];
+    }
+    return { first, std::errc{} };
+}
+
+constexpr decode_result decode_rlp(const std::byte * const first, const std::byte * const last, uint256_t & value) {
+    if (first == last) {
+        return { first, std::errc::invalid_argument };
+    }
+    const unsigned int prefix = (unsigned int)*first;
+    if (prefix < 0x80) {
+        value = prefix;
+        return { first + 1, std::errc{} };
+    }
+    // integers are short strings; longer string and list forms are not integers
+    const std::size_t n = prefix - 0x80;
+    if (n > 55) {
+        return { first, std::errc::invalid_argument };
+    }
+    if (n > 32) {
+        return { first, std::errc::result_out_of_range };
+    }
+    if ((std::size_t)(last - first - 1) < n) {
+        return { first, std::errc::invalid_argument };
+    }
+    const std::byte * const p = first + 1;
+    // canonical: no leading zero byte, and single bytes below 0x80 are not prefixed
+    if (n && ((p[0] == std::byte{ 0 }) || ((n == 1) && ((unsigned int)p[0] < 0x80)))) {
+        return { first, std::errc::invalid_argument };
+    }
+    if (n <= 8) [[likely]] {
+        uint64_t v = 0;
+        for (std::size_t i = 0; i < n; i++) {
+            v = (v << 8) | (uint64_t)p[i];
+        }
+        value = v;
+        return { p + n, std::errc{} };
+    }
+    std::array<std::byte, 32> bytes{};
+    for (std::size_t i = 0; i < n; i++) {
+        bytes[32 - n + i] = p[i];
+    }
+    value = uint256_t::from_bytes_be(bytes);
+    return { p + n, std::errc{} };
+}
+
+// Arrays: values are encoded back to back. On error ptr is where the failing value starts.
+
+constexpr std::size_t leb128_size(const std::span<const uint256_t> values) {
+    std::size_t size = 0;
+    for (const uint256_t & x : values) {
+        size += leb128_size(x);
+    }
+    return size;
+}
+
+constexpr std::size_t rlp_size(const std::span<const uint256_t> values) {
+    std::size_t size = 0;
+    for (const uint256_t & x : values) {
+        size += rlp_size(x);
+    }
+    return size;
+}
+
+constexpr encode_result encode_leb128(const std::span<const uint256_t> values, const std::span<std::byte> out) {
+    std::byte * p = out.data();
+    std::byte * const last = p + out.size();
+    for (const uint256_t & x : values) {
+        const encode_result res = encode_leb128(p, last, x);
+        if (res.ec != std::errc{}) {
+            return { p, res.ec };
+        }
+        p = res.ptr;
+    }
+    return { p, std::errc{} };
+}
+
+constexpr decode_result decode_leb128(const std::span<const std::byte> in, const std::span<uint256_t> values) {
+    const std::byte * p = in.data();
+    const std::byte * const last = p + in.size();
+    for (uint256_t & x : values) {
+        const decode_result res = decode_leb128(p, last, x);
+        if (res.ec != std::errc{}) {
+            return { p, res.ec };
+        }
+        p = res.ptr;
+    }
+    return { p, std::errc{} };
+}
+
+constexpr encode_result encode_rlp(const std::span<const uint256_t> values, const std::span<std::byte> out) {
+    std::byte * p = out.data();
+    std::byte * const last = p + out.size();
+    for (const uint256_t & x : values) {
+        const encode_result res = encode_rlp(p, last, x);
+        if (res.ec != std::errc{}) {
+            return { p, res.ec };
+        }
+        p = res.ptr;
+    }
+    return { p, std::errc{} };
+}
+
+constexpr decode_result decode_rlp(const std::span<const std::byte> in, const std::span<uint256_t> values) {
+    const std::byte * p = in.data();
+    const std::byte * const last = p + in.size();
+    for (uint256_t & x : values) {
+        const decode_result res = decode_rlp(p, last, x);
+        if (res.ec != std::errc{}) {
+            return { p, res.ec };
+        }
+        p = res.ptr;
+    }
+    return { p, std::errc{} };
+}
+
+}
+
+#endif
@@ -0,0 +1,164 @@
+/*
+uint256_divider.h
+Division by a divisor that is reused many times
+
+The divisor is inspected once and division is reduced to multiplications:
+
+    power of two    a shift and a mask
+    below 2^64      one Moller-Granlund reciprocal step per dividend limb
+    otherwise       Granlund-Montgomery: q = (t + ((n - t) >> 1)) >> (l - 1) with
+                    t = mulhi(m, n), l = ceil(log2(d)) and m = floor(2^256 (2^l - d) / d) + 1
+
+Dividers are literal types, so they can be built at compile time:
+
+    constexpr uint256_divider wei(1000000000000000000ULL);
+    static_assert(uint256_t(5000000000000000000ULL) / wei == 5);
+*/
+
+#if !defined(__UINT256_DIVIDER__)
+#define __UINT256_DIVIDER__
+
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include "uint256.h"
+
+class uint256_divider {
+public:
+    constexpr explicit uint256_divider(const uint256_t & divisor)
+        : d_(divisor)
+    {
+        if (!divisor) {
+            throw std::domain_error("Error: division or modulus by 0");
+        }
+
+        const uint16_t bits = divisor.bits();
+        if (!(divisor & (divisor - 1))) {
+            kind_ = kind::shift;
+            shift_ = bits - 1;
+        } else if (bits <= 64) {
+            kind_ = kind::reciprocal;
+            rec_ = uint256::detail::make_reciprocal_64(divisor.lower().lower());
+        } else {
+            // 2^l - d < d, so the 512 by 256-bit quotient fits in 256 bits
+            kind_ = kind::magic;
+            shift_ = bits;
+            const uint256_t e = ((bits == 256) ? uint256_0 : (uint256_1 << bits)) - divisor;
+            uint64_t u[8] = { 0, 0, 0, 0, e.lower().lower(), e.lower().upper(), e.upper().lower(), e.upper().upper() };
+            const uint64_t v[4] = { divisor.lower().lower(), divisor.lower().upper(), divisor.upper().lower(), divisor.upper().upper() };
+            int m = 8;
+            while (!u[m - 1]) {
+                m--;
+            }
+            uint64_t q[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+            uint64_t r[4] = { 0, 0, 0, 0 };
+            uint256::detail::divmod_knuth(u, m, v, (bits + 63) / 64, q, r);
+            magic_ = uint256_t(q[3], q[2], q[1], q[0]) + uint256_1;
+        }
+    }
+
+    constexpr const uint256_t & divisor() const {
+        return d_;
+    }
+
+    constexpr uint256_t quotient(const uint256_t & n) const {
+        switch (kind_) {
+            case kind::shift:
+                return n >> shift_;
+            case kind::reciprocal: {
+                uint64_t x[4] = { n.lower().lower(), n.lower().upper(), n.upper().lower(), n.upper().upper() };
+                uint256::detail::div_limbs_preinv(x, limbs(x), rec_);
+                return uint256_t(x[3], x[2], x[1], x[0]);
+            }
+            default: {
+                if (n < d_) {
+                    return uint256_0;
+                }
+                const uint256_t t = mul_wide(magic_, n).first;
+                return (t + ((n - t) >> 1)) >> (shift_ - 1);
+            }
+        }
+    }
+
+    constexpr uint256_t remainder(const uint256_t & n) const {
+        return divmod(n).second;
+    }
+
+    constexpr std::pair <uint256_t, uint256_t> divmod(const uint256_t & n) const {
+        switch (kind_) {
+            case kind::shift:
+                return std::pair <uint256_t, uint256_t>(n >> shift_, n & (d_ - 1));
+            case kind::reciprocal: {
+                uint64_t x[4] = { n.lower().lower(), n.lower().upper(), n.upper().lower(), n.upper().upper() };
+                const uint64_t r = uint256::detail::div_limbs_preinv(x, limbs(x), rec_);
+                return std::pair <uint256_t, uint256_t>(uint256_t(x[3], x[2], x[1], x[0]), uint256_t(r));
+            }
+            default: {
+                const uint256_t q = quotient(n);
+                return std::pair <uint256_t, uint256_t>(q, n - q * d_);
+            }
+        }
+    }
+
+private:
+    enum class kind : uint8_t {
+        shift,
+        reciprocal,
+        magic,
+    };
+
+    // significant limbs, at least one
+    static constexpr int limbs(const uint64_t (&x)[4]) {
+        int n = 4;
+        while ((n > 1) && !x[n - 1]) {
+            n--;
+        }
+        return n;
+    }
+
+    uint256_t d_;
+    kind kind_ = kind::shift;
+    unsigned int shift_ = 0;
+    uint256::detail::reciprocal_64 rec_ = { 0, 0, 0 };
+    uint256_t magic_ = uint256_0;
+};
+
+constexpr uint256_t operator/(const uint256_t & lhs, const uint256_divider & rhs) {
+    return rhs.quotient(lhs);
+}
+
+constexpr uint256_t operator%(const uint256_t & lhs, const uint256_divider & rhs) {
+    return rhs.remainder(lhs);
+}
+
+constexpr uint256_t & operator/=(uint256_t & lhs, const uint256_divider & rhs) {
+    return lhs = rhs.quotient(lhs);
+}
+
+constexpr uint256_t & operator%=(uint256_t & lhs, const uint256_divider & rhs) {
+    return lhs = rhs.remainder(lhs);
+}
+
+namespace uint256 {
+
+// 10^N for N in [0, 77]
+template <unsigned int N>
+constexpr uint256_t pow10() {
+    static_assert(N <= 77, "10^N does not fit in 256 bits");
+    uint256_t r = uint256_1;
+    for (unsigned int i = 0; i < N; i++) {
+        r *= 10;
+    }
+    return r;
+}
+
+// dividers for decimal scaling, computed at compile time
+template <unsigned int N>
+inline constexpr uint256_divider pow10_divider = uint256_divider(pow10<N>());
+
+}
+
+#endif
@@ -0,0 +1,173 @@
+/*
+uint256_export.h
+Bulk text conversion of uint256_t spans
+
+to_chars_batch formats values into fixed-size chunk buffers on a set of worker threads and
+hands the finished chunks to a sink strictly in input order. Each worker formats a whole
+chunk with the allocation-free to_chars; at most two chunks per worker are in flight, so
+memory stays bounded however long the input is. Chunks are passed to the sink by one
+thread at a time.
+
+    uint256::to_chars_batch(balances, uint256::fd_sink(fd), { .separator = ",\n" });
+*/
+
+#if !defined(__UINT256_EXPORT__)
+#define __UINT256_EXPORT__
+
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#if defined(_WIN32)
+#   include <io.h>
+#else
+#   include <unistd.h>
+#endif
+
+#include "uint256.h"
+#include "uint256_parallel.h"
+
+namespace uint256 {
+
+// receives consecutive pieces of the output; the view is only valid during the call
+using output_sink = std::function<void(std::string_view)>;
+
+// writes everything to an open file descriptor; throws std::system_error when a write fails
+inline output_sink fd_sink(const int fd) {
+    return [fd](std::string_view chunk) {
+        while (!chunk.empty()) {
+#if defined(_WIN32)
+            const int written = ::_write(fd, chunk.data(), (unsigned int)std::min<std::size_t>(chunk.size(), 1u << 30));
+#else
+            const ssize_t written = ::write(fd, chunk.data(), chunk.size());
+#endif
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw std::system_error(errno, std::generic_category(), "Error: write to file descriptor failed");
+            }
+            chunk.remove_prefix((std::size_t)written);
+        }
+    };
+}
+
+struct to_chars_options {
+    int base = 10;
+    // written after every value
+    std::string_view separator = "\n";
+    // values per chunk handed to the sink
+    std::size_t chunk_values = 16384;
+    // 0 uses one worker per hardware thread
+    unsigned int threads = 0;
+};
+
+// Formats every value followed by the separator and streams the text to sink in order.
+// Returns the number of characters written. Exceptions from the sink stop the export and
+// are rethrown once all workers have finished.
+inline std::size_t to_chars_batch(const std::span<const uint256_t> values, const output_sink & sink, const to_chars_options & options = {}) {
+    if ((options.base < 2) || (options.base > 36)) {
+        throw std::invalid_argument("Base must be in the range 2-36");
+    }
+    if (!options.chunk_values) {
+        throw std::invalid_argument("Error: chunk_values must be positive");
+    }
+
+    // the longest value in this base is the maximum
+    char longest[256];
+    const std::size_t digits = to_chars(longest, longest + sizeof(longest), uint256_max, options.base).ptr - longest;
+    const std::size_t stride = digits + options.separator.size();
+
+    const std::size_t chunks = (values.size() + options.chunk_values - 1) / options.chunk_values;
+    const unsigned int threads = uint256::detail::worker_count(options.threads);
+    const std::size_t window = 2 * (std::size_t)threads;
+    const std::size_t capacity = std::min(options.chunk_values, values.size()) * stride;
+
+    struct slot {
+        std::unique_ptr<char[]> data;
+        std::size_t size = 0;
+        bool ready = false;
+    };
+    std::vector<slot> slots(std::min(window, chunks));
+    for (slot & s : slots) {
+        s.data.reset(new char[capacity]);
+    }
+
+    std::mutex mutex;
+    std::condition_variable freed;
+    std::size_t emitted = 0, total = 0;
+    bool emitting = false, aborted = false;
+
+    uint256::detail::parallel_for(chunks, threads, [&](const std::size_t i) {
+        slot & s = slots[i % slots.size()];
+        {
+            // wait until chunk i - window has been emitted
+            std::unique_lock<std::mutex> lock(mutex);
+            freed.wait(lock, [&] {
+                return (i < emitted + slots.size()) || aborted;
+            });
+            if (aborted) {
+                return;
+            }
+        }
+
+        const std::size_t first = i * options.chunk_values;
+        const std::size_t last = std::min(first + options.chunk_values, values.size());
+        char * p = s.data.get();
+        char * const end = p + capacity;
+        for (std::size_t j = first; j < last; j++) {
+            p = to_chars(p, end, values[j], options.base).ptr;
+            for (const char c : options.separator) {
+                *p++ = c;
+            }
+        }
+        s.size = p - s.data.get();
+
+        // whoever finds the next chunk ready emits it, and any that follow, one thread at a time
+        std::unique_lock<std::mutex> lock(mutex);
+        s.ready = true;
+        if (emitting) {
+            return;
+        }
+        emitting = true;
+        try {
+            while (!aborted && slots[emitted % slots.size()].ready) {
+                slot & next = slots[emitted % slots.size()];
+                lock.unlock();
+                sink(std::string_view(next.data.get(), next.size));
+                lock.lock();
+                total += next.size;
+                next.ready = false;
+                emitted++;
+                freed.notify_all();
+            }
+        } catch (...) {
+            if (!lock.owns_lock()) {
+                lock.lock();
+            }
+            aborted = true;
+            emitting = false;
+            freed.notify_all();
+            throw;
+        }
+        emitting = false;
+    });
+    return total;
+}
+
+}
+
+#endif
@@ -0,0 +1,310 @@
+/*
+uint256_format.h
+std::format and {fmt} support for uint256_t
+
+Specializes std::formatter<uint256_t> when the standard library has <format>, and
+fmt::formatter<uint256_t> when {fmt} was included before this header. Both accept
+
+    [[fill]align][sign][#][0][width][grouping][type]
+
+with the integer meanings from std::format: types d (default), x, X, b, B and o, '#' for
+the 0x / 0X / 0b / 0B / 0 prefix, '0' for zero padding after the prefix, and a fill of any
+single character. Grouping is ',' or '_' and separates groups of three decimal digits, or
+four digits in the other bases. Width must be a literal number; dynamic widths, precision
+and the locale flag are rejected when the format string is parsed.
+
+Digits come from to_chars into a stack buffer and go straight to the output iterator, so
+formatting never allocates.
+
+    std::format("{:#066x}", hash);   // 0x000...1f
+    std::format("{:>30,}", balance); //      1,000,000,000,000,000,000
+*/
+
+#if !defined(__UINT256_FORMAT__)
+#define __UINT256_FORMAT__
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <version>
+
+#if defined(__cpp_lib_format)
+#   include <format>
+#endif
+
+#include "uint256.h"
+
+namespace uint256::detail {
+
+// one parsed replacement field
+struct format_spec {
+    // UTF-8 encoded fill character
+    char fill[4] = { ' ', 0, 0, 0 };
+    unsigned int fill_size = 1;
+    // '<', '>', '^' or 0 for the default right alignment
+    char align = 0;
+    // '-' (nothing), '+' or ' ' in front of the value
+    char sign = '-';
+    bool alternate = false;
+    bool zero = false;
+    std::size_t width = 0;
+    // ',', '_' or 0
+    char grouping = 0;
+    char type = 'd';
+};
+
+constexpr int format_base(const char type) {
+    switch (type) {
+        case 'x': case 'X': return 16;
+        case 'b': case 'B': return 2;
+        case 'o':           return 8;
+        default:            return 10;
+    }
+}
+
+// Parses a spec up to the closing '}'. error is called with a message for a malformed spec
+// and must not return; the formatters throw their library's format_error from it.
+template <typename It, typename Error>
+constexpr It parse_format_spec(It it, const It last, format_spec & spec, const Error & error) {
+    const auto is_align = [](const char c) {
+        return (c == '<') || (c == '>') || (c == '^');
+    };
+    if ((it == last) || (*it == '}')) {
+        return it;
+    }
+
+    // a fill is only recognized in front of an alignment
+    const unsigned char lead = (unsigned char)*it;
+    const std::size_t n = (lead >= 0xf0) ? 4 : (lead >= 0xe0) ? 3 : (lead >= 0xc0) ? 2 : 1;
+    if (((std::size_t)(last - it) > n) && is_align(it[n])) {
+        if ((*it == '{') || (*it == '}')) {
+            error("Error: '{' and '}' cannot be used as fill");
+        }
+        for (std::size_t i = 0; i < n; i++) {
+            spec.fill[i] = it[i];
+        }
+        spec.fill_size = (unsigned int)n;
+        spec.align = it[n];
+        it += n + 1;
+    } else if (is_align(*it)) {
+        spec.align = *it++;
+    }
+
+    if ((it != last) && ((*it == '+') || (*it == '-') || (*it == ' '))) {
+        spec.sign = *it++;
+    }
+    if ((it != last) && (*it == '#')) {
+        spec.alternate = true;
+        ++it;
+    }
+    if ((it != last) && (*it == '0')) {
+        spec.zero = true;
+        ++it;
+    }
+    while ((it != last) && ('0' <= *it) && (*it <= '9')) {
+        spec.width = spec.width * 10 + (std::size_t)(*it++ - '0');
+        if (spec.width > 1000000) {
+            error("Error: format width is too large");
+        }
+    }
+    if ((it != last) && (*it == '{')) {
+        error("Error: dynamic width is not supported for uint256_t");
+    }
+    if ((it != last) && ((*it == ',') || (*it == '_'))) {
+        spec.grouping = *it++;
+    }
+    if ((it != last) && (*it == '.')) {
+        error("Error: precision is not allowed for uint256_t");
+    }
+    if ((it != last) && (*it == 'L')) {
+        error("Error: locale formatting is not supported for uint256_t, use ',' or '_' grouping");
+    }
+    if ((it != last) && (*it != '}')) {
+        switch (*it) {
+            case 'd': case 'x': case 'X': case 'b': case 'B': case 'o':
+                spec.type = *it++;
+                break;
+            default:
+                error("Error: invalid type for uint256_t");
+        }
+    }
+    if ((it != last) && (*it != '}')) {
+        error("Error: invalid format specification for uint256_t");
+    }
+    return it;
+}
+
+// copies a range to the output; the formatters pass one that appends the whole range at once
+struct format_copy {
+    template <typename Out>
+    constexpr Out operator()(Out out, const char * first, const char * last) const {
+        return std::copy(first, last, out);
+    }
+};
+
+// collects the field so that it usually reaches the output in a single write
+template <typename Out, typename Write>
+struct format_buffer {
+    constexpr format_buffer(const Out first, const Write & writer)
+        : out(first), write(writer)
+    {}
+
+    constexpr void put(const char * first, const char * last) {
+        const std::size_t n = last - first;
+        if (size + n > sizeof(data)) {
+            flush();
+            if (n > sizeof(data)) {
+                out = write(out, first, last);
+                return;
+            }
+        }
+        std::copy(first, last, data + size);
+        size += n;
+    }
+
+    // count copies of an n byte character
+    constexpr void fill(const char * c, const std::size_t n, std::size_t count) {
+        while (count) {
+            if (size + n > sizeof(data)) {
+                flush();
+            }
+            const std::size_t k = std::min(count, (sizeof(data) - size) / n);
+            for (std::size_t i = 0; i < k; i++) {
+                std::copy(c, c + n, data + size);
+                size += n;
+            }
+            count -= k;
+        }
+    }
+
+    constexpr Out flush() {
+        if (size) {
+            out = write(out, (const char *)data, (const char *)data + size);
+            size = 0;
+        }
+        return out;
+    }
+
+    Out out;
+    const Write & write;
+    char data[512];
+    std::size_t size = 0;
+};
+
+template <typename Out, typename Write = format_copy>
+constexpr Out write_formatted(const Out out, const uint256_t & value, const format_spec & spec, const Write & write = {}) {
+    const int base = format_base(spec.type);
+    uint64_t x[4] = { value.lower().lower(), value.lower().upper(), value.upper().lower(), value.upper().upper() };
+    char digits[256];
+    char * const end = digits + sizeof(digits);
+    char * const begin = std::has_single_bit((unsigned int)base)
+        ? to_chars_pow2(end, x, std::countr_zero((unsigned int)base))
+        : to_chars_radix(end, x, base);
+    const std::size_t count = end - begin;
+    if (spec.type == 'X') {
+        std::transform(begin, end, begin, [](const char c) {
+            return (c >= 'a') ? (char)(c - 'a' + 'A') : c;
+        });
+    }
+
+    char prefix[3];
+    std::size_t prefix_size = 0;
+    if (spec.sign != '-') {
+        prefix[prefix_size++] = spec.sign;
+    }
+    if (spec.alternate && (base != 10)) {
+        // like the built-in integers, octal zero is just "0"
+        if ((base != 8) || value) {
+            prefix[prefix_size++] = '0';
+        }
+        if (base != 8) {
+            prefix[prefix_size++] = spec.type;
+        }
+    }
+
+    const std::size_t group = (base == 10) ? 3 : 4;
+    const std::size_t size = prefix_size + count + (spec.grouping ? (count - 1) / group : 0);
+    const std::size_t pad = (spec.width > size) ? (spec.width - size) : 0;
+    // zero padding goes after the prefix and only applies without an explicit alignment
+    const bool zero = spec.zero && !spec.align;
+    const std::size_t before = (zero || (spec.align == '<')) ? 0 : (spec.align == '^') ? (pad / 2) : pad;
+    const std::size_t after = zero ? 0 : (pad - before);
+
+    format_buffer<Out, Write> buffer(out, write);
+    buffer.fill(spec.fill, spec.fill_size, before);
+    buffer.put(prefix, prefix + prefix_size);
+    if (zero) {
+        buffer.fill("0", 1, pad);
+    }
+    if (spec.grouping) {
+        // the first group is the short one; binary has 256 digits and 63 separators
+        char grouped[256 + 63];
+        const char * d = begin + (count - 1) % group + 1;
+        char * p = std::copy((const char *)begin, d, grouped);
+        for (; d != end; d += group) {
+            p[0] = spec.grouping;
+            p[1] = d[0];
+            p[2] = d[1];
+            p[3] = d[2];
+            if (group == 4) {
+                p[4] = d[3];
+            }
+            p += group + 1;
+        }
+        buffer.put(grouped, p);
+    } else {
+        buffer.put(begin, end);
+    }
+    buffer.fill(spec.fill, spec.fill_size, after);
+    return buffer.flush();
+}
+}
+
+#if defined(__cpp_lib_format)
+template <>
+struct std::formatter<uint256_t, char> {
+    uint256::detail::format_spec spec;
+
+    constexpr std::format_parse_context::iterator parse(std::format_parse_context & ctx) {
+        return uint256::detail::parse_format_spec(ctx.begin(), ctx.end(), spec, [](const char * message) {
+            throw std::format_error(message);
+        });
+    }
+
+    // pieces go through the string formatter, which appends them in bulk
+    template <typename FormatContext>
+    typename FormatContext::iterator format(const uint256_t & value, FormatContext & ctx) const {
+        return uint256::detail::write_formatted(ctx.out(), value, spec, [&ctx](const typename FormatContext::iterator out, const char * first, const char * last) {
+            ctx.advance_to(out);
+            return std::formatter<std::string_view, char>().format(std::string_view(first, last - first), ctx);
+        });
+    }
+};
+#endif
+
+#if defined(FMT_VERSION)
+template <>
+struct fmt::formatter<uint256_t> {
+    uint256::detail::format_spec spec;
+
+    constexpr fmt::format_parse_context::iterator parse(fmt::format_parse_context & ctx) {
+        return uint256::detail::parse_format_spec(ctx.begin(), ctx.end(), spec, [](const char * message) {
+            throw fmt::format_error(message);
+        });
+    }
+
+    template <typename FormatContext>
+    auto format(const uint256_t & value, FormatContext & ctx) const -> decltype(ctx.out()) {
+        return uint256::detail::write_formatted(ctx.out(), value, spec, [&ctx](const decltype(ctx.out()) out, const char * first, const char * last) {
+            ctx.advance_to(out);
+            return fmt::formatter<fmt::string_view>().format(fmt::string_view(first, last - first), ctx);
+        });
+    }
+};
+#endif
+
+#endif
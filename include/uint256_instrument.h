@@ -0,0 +1,344 @@
+/*
+uint256_instrument.h
+Operation counters for profiling builds
+
+When UINT256_INSTRUMENT is defined (the CMake option of the same name), divmod, operator*,
+str(), init_from_base and export_bits / export_bits_truncate count every call, bucket
+their operands by bits(), and time one call in sample_period() with the time stamp
+counter (steady_clock nanoseconds where there is none). Nested calls of the same
+operation, such as divmod by a uint128_t forwarding to divmod by a uint64_t, count once.
+
+Counters live in per-thread blocks that only their own thread writes, so a probe costs a
+few relaxed loads and stores. snapshot() adds up all threads, including ones that have
+exited, and dump() writes the totals in the Prometheus text format.
+
+Without UINT256_INSTRUMENT the probes are not compiled in at all; this header still
+declares the same API, and snapshot() returns zeros, so exporters build either way.
+
+    uint256::instrument::dump(metrics_stream);
+*/
+
+#if !defined(__UINT256_INSTRUMENT__)
+#define __UINT256_INSTRUMENT__
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#if defined(UINT256_INSTRUMENT)
+#   if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#       include <x86intrin.h>
+#       define UINT256_INSTRUMENT_RDTSC
+#   elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#       include <intrin.h>
+#       define UINT256_INSTRUMENT_RDTSC
+#   endif
+#endif
+
+namespace uint256::instrument {
+
+#if defined(UINT256_INSTRUMENT)
+inline constexpr bool enabled = true;
+#else
+inline constexpr bool enabled = false;
+#endif
+
+enum class operation : unsigned int {
+    divmod,
+    multiply,
+    str,
+    init_from_base,
+    export_bits,
+};
+
+inline constexpr std::size_t operation_count = 5;
+
+constexpr std::string_view name(const operation op) {
+    constexpr std::string_view names[operation_count] = { "divmod", "multiply", "str", "init_from_base", "export_bits" };
+    return names[(std::size_t)op];
+}
+
+// widths in 32-bit buckets: [0] counts zero, [i] counts widths from 32i - 31 to 32i
+inline constexpr std::size_t bit_buckets = 9;
+
+constexpr std::size_t bit_bucket(const unsigned int bits) {
+    return (bits + 31) / 32;
+}
+
+struct operation_stats {
+    uint64_t calls = 0;
+    // first and second operand; unary operations only fill lhs_bits
+    std::array<uint64_t, bit_buckets> lhs_bits{};
+    std::array<uint64_t, bit_buckets> rhs_bits{};
+    // timed calls and their total duration
+    uint64_t sampled = 0;
+    uint64_t cycles = 0;
+};
+
+struct stats {
+    std::array<operation_stats, operation_count> operations{};
+
+    const operation_stats & operator[](const operation op) const {
+        return operations[(std::size_t)op];
+    }
+};
+
+}
+
+namespace uint256::instrument::detail {
+
+// one thread's counters; written only by that thread, read by snapshot()
+struct thread_counters;
+
+struct registry {
+    std::mutex mutex;
+    std::vector<thread_counters *> live;
+    // totals of exited threads, and the totals at the last reset()
+    stats retired, baseline;
+    std::atomic<uint32_t> sample_period{ 64 };
+};
+
+// never destroyed, so threads that outlive static destruction can still retire
+inline registry & global() {
+    static registry * const r = new registry;
+    return *r;
+}
+
+struct counter {
+    std::atomic<uint64_t> value{ 0 };
+
+    void add(const uint64_t n) {
+        value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    uint64_t load() const {
+        return value.load(std::memory_order_relaxed);
+    }
+};
+
+struct thread_counters {
+    struct row {
+        counter calls;
+        counter lhs_bits[bit_buckets];
+        counter rhs_bits[bit_buckets];
+        counter sampled;
+        counter cycles;
+    };
+
+    row rows[operation_count];
+    // owner only
+    uint32_t until_sample[operation_count] = {};
+    bool active[operation_count] = {};
+
+    thread_counters() {
+        const std::lock_guard<std::mutex> lock(global().mutex);
+        global().live.push_back(this);
+    }
+
+    thread_counters(const thread_counters &) = delete;
+    thread_counters & operator=(const thread_counters &) = delete;
+
+    ~thread_counters() {
+        registry & r = global();
+        const std::lock_guard<std::mutex> lock(r.mutex);
+        add_to(r.retired);
+        std::erase(r.live, this);
+    }
+
+    void add_to(stats & s) const {
+        for (std::size_t op = 0; op < operation_count; op++) {
+            const row & from = rows[op];
+            operation_stats & to = s.operations[op];
+            to.calls += from.calls.load();
+            for (std::size_t b = 0; b < bit_buckets; b++) {
+                to.lhs_bits[b] += from.lhs_bits[b].load();
+                to.rhs_bits[b] += from.rhs_bits[b].load();
+            }
+            to.sampled += from.sampled.load();
+            to.cycles += from.cycles.load();
+        }
+    }
+};
+
+inline thread_counters & local() {
+    thread_local thread_counters counters;
+    return counters;
+}
+
+inline uint64_t timestamp() {
+#if defined(UINT256_INSTRUMENT_RDTSC)
+    return __rdtsc();
+#else
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+}
+
+namespace uint256::instrument {
+
+// passed for the second operand of unary operations
+inline constexpr unsigned int no_operand = ~0u;
+
+// Counts one call for its lifetime. Literal so it can sit in constexpr functions; constant
+// evaluation records nothing.
+class probe {
+public:
+    constexpr explicit probe(const operation op, const unsigned int lhs_bits = no_operand, const unsigned int rhs_bits = no_operand) {
+        if (!std::is_constant_evaluated()) {
+            start(op, lhs_bits, rhs_bits);
+        }
+    }
+
+    probe(const probe &) = delete;
+    probe & operator=(const probe &) = delete;
+
+    // for operations whose operand is only known at the end, such as parsing
+    constexpr void operand(const unsigned int bits) {
+        if (!std::is_constant_evaluated() && row_) {
+            row_->lhs_bits[bit_bucket(bits)].add(1);
+        }
+    }
+
+    constexpr ~probe() {
+        if (!std::is_constant_evaluated() && row_) {
+            finish();
+        }
+    }
+
+private:
+    void start(const operation op, const unsigned int lhs_bits, const unsigned int rhs_bits) {
+        detail::thread_counters & t = detail::local();
+        const std::size_t i = (std::size_t)op;
+        if (t.active[i]) {
+            return;
+        }
+        t.active[i] = true;
+        row_ = &t.rows[i];
+        active_ = &t.active[i];
+        row_->calls.add(1);
+        if (lhs_bits != no_operand) {
+            row_->lhs_bits[bit_bucket(lhs_bits)].add(1);
+        }
+        if (rhs_bits != no_operand) {
+            row_->rhs_bits[bit_bucket(rhs_bits)].add(1);
+        }
+        if (!t.until_sample[i]) {
+            t.until_sample[i] = detail::global().sample_period.load(std::memory_order_relaxed);
+            start_ = detail::timestamp();
+        }
+        t.until_sample[i]--;
+    }
+
+    void finish() {
+        if (start_) {
+            row_->cycles.add(detail::timestamp() - start_);
+            row_->sampled.add(1);
+        }
+        *active_ = false;
+    }
+
+    detail::thread_counters::row * row_ = nullptr;
+    bool * active_ = nullptr;
+    uint64_t start_ = 0;
+};
+
+// one call in period is timed; 1 times every call
+inline void set_sample_period(const uint32_t period) {
+    detail::global().sample_period.store(period ? period : 1, std::memory_order_relaxed);
+}
+
+inline uint32_t sample_period() {
+    return detail::global().sample_period.load(std::memory_order_relaxed);
+}
+
+// totals since the last reset() over all threads
+inline stats snapshot() {
+    stats s;
+    if constexpr (enabled) {
+        detail::registry & r = detail::global();
+        const std::lock_guard<std::mutex> lock(r.mutex);
+        s = r.retired;
+        for (const detail::thread_counters * t : r.live) {
+            t->add_to(s);
+        }
+        for (std::size_t op = 0; op < operation_count; op++) {
+            operation_stats & to = s.operations[op];
+            const operation_stats & base = r.baseline.operations[op];
+            to.calls -= base.calls;
+            for (std::size_t b = 0; b < bit_buckets; b++) {
+                to.lhs_bits[b] -= base.lhs_bits[b];
+                to.rhs_bits[b] -= base.rhs_bits[b];
+            }
+            to.sampled -= base.sampled;
+            to.cycles -= base.cycles;
+        }
+    }
+    return s;
+}
+
+// counters keep running; later snapshots count from here
+inline void reset() {
+    if constexpr (enabled) {
+        stats total;
+        detail::registry & r = detail::global();
+        const std::lock_guard<std::mutex> lock(r.mutex);
+        total = r.retired;
+        for (const detail::thread_counters * t : r.live) {
+            t->add_to(total);
+        }
+        r.baseline = total;
+    }
+}
+
+// Prometheus text exposition of a snapshot
+inline void dump(std::ostream & out, const stats & s) {
+    const auto buckets = [&](const std::string_view op, const std::string_view operand, const std::array<uint64_t, bit_buckets> & counts) {
+        for (std::size_t b = 0; b < bit_buckets; b++) {
+            if (counts[b]) {
+                out << "uint256_operand_bits_total{op=\"" << op << "\",operand=\"" << operand << "\",bits=\"";
+                if (b) {
+                    out << (32 * b - 31) << '-' << (32 * b);
+                } else {
+                    out << '0';
+                }
+                out << "\"} " << counts[b] << '\n';
+            }
+        }
+    };
+
+    out << "# TYPE uint256_operations_total counter\n";
+    for (std::size_t op = 0; op < operation_count; op++) {
+        out << "uint256_operations_total{op=\"" << name((operation)op) << "\"} " << s.operations[op].calls << '\n';
+    }
+    out << "# TYPE uint256_operand_bits_total counter\n";
+    for (std::size_t op = 0; op < operation_count; op++) {
+        buckets(name((operation)op), "lhs", s.operations[op].lhs_bits);
+        buckets(name((operation)op), "rhs", s.operations[op].rhs_bits);
+    }
+    out << "# TYPE uint256_sampled_calls_total counter\n";
+    for (std::size_t op = 0; op < operation_count; op++) {
+        out << "uint256_sampled_calls_total{op=\"" << name((operation)op) << "\"} " << s.operations[op].sampled << '\n';
+    }
+    out << "# TYPE uint256_sampled_cycles_total counter\n";
+    for (std::size_t op = 0; op < operation_count; op++) {
+        out << "uint256_sampled_cycles_total{op=\"" << name((operation)op) << "\"} " << s.operations[op].cycles << '\n';
+    }
+}
+
+inline void dump(std::ostream & out) {
+    dump(out, snapshot());
+}
+
+}
+
+#endif
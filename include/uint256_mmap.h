@@ -0,0 +1,476 @@
+/*
+uint256_mmap.h
+Memory-mappable fixed-width binary files of uint256_t values
+
+File format, version 1. Header integers are little endian regardless of the host:
+
+    offset  size  field
+         0     8  magic "UINT256A"
+         8     2  version, 1
+        10     1  byte order of every value: 0 = little endian, 1 = big endian
+        11     1  flags: bit 0 = checksum present, other bits are zero
+        12     4  data offset in bytes, a multiple of 64; 64 in version 1
+        16     8  number of values
+        24     8  checksum of the data, zero when absent
+        32    32  reserved, zero
+        64     -  values, 32 bytes each, in the byte order above
+
+A value in little endian order is its least significant limb first, each limb little endian;
+big endian is the exact reverse. Those are the in-memory layouts uint256_t has under
+__LITTLE_ENDIAN__ and __BIG_ENDIAN__, so a file written in host order is mapped and read
+in place. The data starts 64 bytes into a page aligned mapping, so every value is aligned.
+
+The checksum reads each value as four 64-bit little endian words w0..w3 in file order and
+folds them into h, starting from h = 0:
+
+    h = f(h ^ w0 ^ 0xa0761d6478bd642f, w1 ^ 0xe7037ed1a0b428db) ^ f(w2 ^ 0x8ebc6af09c88c6e3, w3 ^ 0x589965cc75374cc3)
+
+where f(a, b) is the exclusive or of the two halves of the 128-bit product a * b.
+
+    {
+        uint256_mmap_writer out("slots.u256");
+        out.write(slots);
+    }
+    const uint256_mmap_array in("slots.u256");
+    const std::span<const uint256_t> values = in.values();
+*/
+
+#if !defined(__UINT256_MMAP__)
+#define __UINT256_MMAP__
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#if defined(_WIN32)
+#   if !defined(NOMINMAX)
+#       define NOMINMAX
+#   endif
+#   if !defined(WIN32_LEAN_AND_MEAN)
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   include <windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+#include "uint256.h"
+
+namespace uint256 {
+
+enum class byte_order : uint8_t {
+    little = 0,
+    big = 1,
+};
+
+}
+
+namespace uint256::detail {
+
+inline constexpr char mmap_magic[8] = { 'U', 'I', 'N', 'T', '2', '5', '6', 'A' };
+inline constexpr uint16_t mmap_version = 1;
+inline constexpr std::size_t mmap_header_size = 64;
+inline constexpr uint8_t mmap_flag_checksum = 1;
+
+struct mmap_header {
+    byte_order order = byte_order::little;
+    uint8_t flags = 0;
+    uint32_t data_offset = mmap_header_size;
+    uint64_t count = 0;
+    uint64_t checksum = 0;
+};
+
+inline std::array<std::byte, mmap_header_size> encode_mmap_header(const mmap_header & h) {
+    std::array<std::byte, mmap_header_size> out{};
+    std::memcpy(out.data(), mmap_magic, sizeof(mmap_magic));
+    out[8] = (std::byte)(mmap_version & 0xff);
+    out[9] = (std::byte)(mmap_version >> 8);
+    out[10] = (std::byte)h.order;
+    out[11] = (std::byte)h.flags;
+    for (int i = 0; i < 4; i++) {
+        out[12 + i] = (std::byte)((h.data_offset >> (8 * i)) & 0xff);
+    }
+    store_limb(out.data() + 16, to_little_endian(h.count));
+    store_limb(out.data() + 24, to_little_endian(h.checksum));
+    return out;
+}
+
+// throws std::runtime_error unless the bytes are a version 1 header
+inline mmap_header decode_mmap_header(const std::byte * in, const std::size_t size) {
+    if ((size < mmap_header_size) || std::memcmp(in, mmap_magic, sizeof(mmap_magic))) {
+        throw std::runtime_error("Error: not a uint256_t array file");
+    }
+    if ((((uint16_t)in[9] << 8) | (uint16_t)in[8]) != mmap_version) {
+        throw std::runtime_error("Error: unsupported uint256_t array file version");
+    }
+    mmap_header h;
+    h.order = (byte_order)in[10];
+    h.flags = (uint8_t)in[11];
+    h.data_offset = 0;
+    for (int i = 0; i < 4; i++) {
+        h.data_offset |= (uint32_t)in[12 + i] << (8 * i);
+    }
+    h.count = to_little_endian(load_limb(in + 16));
+    h.checksum = to_little_endian(load_limb(in + 24));
+    if (((h.order != byte_order::little) && (h.order != byte_order::big)) || (h.flags & ~mmap_flag_checksum) ||
+        (h.data_offset < mmap_header_size) || (h.data_offset % 64)) {
+        throw std::runtime_error("Error: corrupt uint256_t array header");
+    }
+    return h;
+}
+
+inline uint64_t mmap_checksum(uint64_t h, const std::byte * data, const std::size_t count) {
+    for (std::size_t i = 0; i < count; i++, data += 32) {
+        const uint64_t w0 = to_little_endian(load_limb(data));
+        const uint64_t w1 = to_little_endian(load_limb(data + 8));
+        const uint64_t w2 = to_little_endian(load_limb(data + 16));
+        const uint64_t w3 = to_little_endian(load_limb(data + 24));
+        h = fold_mul_64(h ^ w0 ^ 0xa0761d6478bd642fULL, w1 ^ 0xe7037ed1a0b428dbULL) ^
+            fold_mul_64(w2 ^ 0x8ebc6af09c88c6e3ULL, w3 ^ 0x589965cc75374cc3ULL);
+    }
+    return h;
+}
+
+// the byte order uint256_t objects have in memory, if it is one of the two file orders
+inline bool native_byte_order(byte_order & order) {
+    static const int native = [] {
+        std::array<std::byte, 32> pattern;
+        for (int i = 0; i < 32; i++) {
+            pattern[i] = (std::byte)i;
+        }
+        const uint256_t x = uint256_t::from_bytes_le(pattern);
+        std::array<std::byte, 32> image;
+        std::memcpy(image.data(), &x, sizeof(x));
+        if (image == pattern) {
+            return (int)byte_order::little;
+        }
+        return (image == x.to_bytes_be()) ? (int)byte_order::big : -1;
+    }();
+    order = (byte_order)native;
+    return native >= 0;
+}
+
+inline uint256_t decode_value(const std::byte * p, const byte_order order) {
+    const std::span<const std::byte, 32> bytes(p, 32);
+    return (order == byte_order::little) ? uint256_t::from_bytes_le(bytes) : uint256_t::from_bytes_be(bytes);
+}
+
+inline void encode_value(std::byte * p, const uint256_t & x, const byte_order order) {
+    const std::span<std::byte, 32> bytes(p, 32);
+    if (order == byte_order::little) {
+        x.to_bytes_le(bytes);
+    } else {
+        x.to_bytes_be(bytes);
+    }
+}
+
+}
+
+// Read-only view of a uint256_t array file. values() is a zero-copy span when the file is in
+// the host's byte order; operator[] and at() decode either order.
+class uint256_mmap_array {
+public:
+    // throws std::system_error when the file cannot be mapped and std::runtime_error when it
+    // is not a valid array file; verify also checks the checksum when the file carries one
+    explicit uint256_mmap_array(const std::string & path, const bool verify = false) {
+        map(path);
+        try {
+            header_ = uint256::detail::decode_mmap_header(base_, size_);
+            if ((size_ < header_.data_offset) || (header_.count > (size_ - header_.data_offset) / 32)) {
+                throw std::runtime_error("Error: uint256_t array file is truncated");
+            }
+            uint256::byte_order native;
+            zero_copy_ = uint256::detail::native_byte_order(native) && (native == header_.order);
+            if (verify && !this->verify()) {
+                throw std::runtime_error("Error: uint256_t array checksum mismatch");
+            }
+        } catch (...) {
+            unmap();
+            throw;
+        }
+    }
+
+    uint256_mmap_array(const uint256_mmap_array &) = delete;
+    uint256_mmap_array & operator=(const uint256_mmap_array &) = delete;
+
+    uint256_mmap_array(uint256_mmap_array && rhs) noexcept
+        : base_(std::exchange(rhs.base_, nullptr)), size_(std::exchange(rhs.size_, 0)),
+          header_(rhs.header_), zero_copy_(rhs.zero_copy_)
+#if defined(_WIN32)
+        , mapping_(std::exchange(rhs.mapping_, nullptr))
+#endif
+    {}
+
+    uint256_mmap_array & operator=(uint256_mmap_array && rhs) noexcept {
+        if (this != &rhs) {
+            unmap();
+            base_ = std::exchange(rhs.base_, nullptr);
+            size_ = std::exchange(rhs.size_, 0);
+            header_ = rhs.header_;
+            zero_copy_ = rhs.zero_copy_;
+#if defined(_WIN32)
+            mapping_ = std::exchange(rhs.mapping_, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+    ~uint256_mmap_array() {
+        unmap();
+    }
+
+    std::size_t size() const {
+        return (std::size_t)header_.count;
+    }
+
+    bool empty() const {
+        return !header_.count;
+    }
+
+    uint256::byte_order byte_order() const {
+        return header_.order;
+    }
+
+    bool zero_copy() const {
+        return zero_copy_;
+    }
+
+    bool has_checksum() const {
+        return header_.flags & uint256::detail::mmap_flag_checksum;
+    }
+
+    // the stored value bytes
+    std::span<const std::byte> bytes() const {
+        return std::span<const std::byte>(data(), size() * 32);
+    }
+
+    // throws std::runtime_error when the file is not in host byte order
+    std::span<const uint256_t> values() const {
+        if (!zero_copy_) {
+            throw std::runtime_error("Error: uint256_t array file is not in host byte order");
+        }
+        return std::span<const uint256_t>(reinterpret_cast<const uint256_t *>(data()), size());
+    }
+
+    uint256_t operator[](const std::size_t i) const {
+        return uint256::detail::decode_value(data() + i * 32, header_.order);
+    }
+
+    uint256_t at(const std::size_t i) const {
+        if (i >= size()) {
+            throw std::out_of_range("Error: uint256_t array index out of range");
+        }
+        return (*this)[i];
+    }
+
+    // true when the file has no checksum
+    bool verify() const {
+        return !has_checksum() || (uint256::detail::mmap_checksum(0, data(), size()) == header_.checksum);
+    }
+
+private:
+    const std::byte * data() const {
+        return base_ + header_.data_offset;
+    }
+
+#if defined(_WIN32)
+    void map(const std::string & path) {
+        const HANDLE file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::system_error((int)::GetLastError(), std::system_category(), "Error: cannot open " + path);
+        }
+        LARGE_INTEGER size;
+        if (!::GetFileSizeEx(file, &size)) {
+            const DWORD error = ::GetLastError();
+            ::CloseHandle(file);
+            throw std::system_error((int)error, std::system_category(), "Error: cannot stat " + path);
+        }
+        // an empty file cannot be mapped and is not an array file either
+        if ((uint64_t)size.QuadPart < uint256::detail::mmap_header_size) {
+            ::CloseHandle(file);
+            throw std::runtime_error("Error: not a uint256_t array file");
+        }
+        mapping_ = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        ::CloseHandle(file);
+        if (!mapping_) {
+            throw std::system_error((int)::GetLastError(), std::system_category(), "Error: cannot map " + path);
+        }
+        base_ = static_cast<const std::byte *>(::MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        if (!base_) {
+            const DWORD error = ::GetLastError();
+            ::CloseHandle(mapping_);
+            mapping_ = nullptr;
+            throw std::system_error((int)error, std::system_category(), "Error: cannot map " + path);
+        }
+        size_ = (std::size_t)size.QuadPart;
+    }
+
+    void unmap() {
+        if (base_) {
+            ::UnmapViewOfFile(base_);
+            ::CloseHandle(mapping_);
+            base_ = nullptr;
+            mapping_ = nullptr;
+        }
+    }
+
+    HANDLE mapping_ = nullptr;
+#else
+    void map(const std::string & path) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(), "Error: cannot open " + path);
+        }
+        struct stat st;
+        if (::fstat(fd, &st)) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "Error: cannot stat " + path);
+        }
+        // an empty file cannot be mapped and is not an array file either
+        if ((std::size_t)st.st_size < uint256::detail::mmap_header_size) {
+            ::close(fd);
+            throw std::runtime_error("Error: not a uint256_t array file");
+        }
+        void * const p = ::mmap(nullptr, (std::size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        const int error = errno;
+        ::close(fd);
+        if (p == MAP_FAILED) {
+            throw std::system_error(error, std::generic_category(), "Error: cannot map " + path);
+        }
+        base_ = static_cast<const std::byte *>(p);
+        size_ = (std::size_t)st.st_size;
+    }
+
+    void unmap() {
+        if (base_) {
+            ::munmap(const_cast<std::byte *>(base_), size_);
+            base_ = nullptr;
+        }
+    }
+#endif
+
+    const std::byte * base_ = nullptr;
+    std::size_t size_ = 0;
+    uint256::detail::mmap_header header_;
+    bool zero_copy_ = false;
+};
+
+// Streams values into a new array file. The header is written when the writer is closed;
+// until then the file is marked with a zero count and no checksum.
+class uint256_mmap_writer {
+public:
+    // throws std::system_error when the file cannot be created
+    explicit uint256_mmap_writer(const std::string & path, const bool checksum = true)
+        : uint256_mmap_writer(path, checksum, host_order())
+    {}
+
+    uint256_mmap_writer(const std::string & path, const bool checksum, const uint256::byte_order order)
+        : file_(std::fopen(path.c_str(), "wb"))
+    {
+        if (!file_) {
+            throw std::system_error(errno, std::generic_category(), "Error: cannot create " + path);
+        }
+        header_.order = order;
+        header_.flags = checksum ? uint256::detail::mmap_flag_checksum : 0;
+        uint256::byte_order native;
+        raw_ = uint256::detail::native_byte_order(native) && (native == order);
+        std::setvbuf(file_, nullptr, _IOFBF, std::size_t(1) << 16);
+        const std::array<std::byte, uint256::detail::mmap_header_size> placeholder = uint256::detail::encode_mmap_header({ order, 0, uint256::detail::mmap_header_size, 0, 0 });
+        if (std::fwrite(placeholder.data(), 1, placeholder.size(), file_) != placeholder.size()) {
+            const int error = errno;
+            std::fclose(file_);
+            throw std::system_error(error ? error : EIO, std::generic_category(), "Error: cannot write " + path);
+        }
+    }
+
+    uint256_mmap_writer(const uint256_mmap_writer &) = delete;
+    uint256_mmap_writer & operator=(const uint256_mmap_writer &) = delete;
+
+    // closes the file; errors are lost, call close() to see them
+    ~uint256_mmap_writer() {
+        try {
+            close();
+        } catch (...) {
+        }
+    }
+
+    void write(const uint256_t & value) {
+        std::byte bytes[32];
+        uint256::detail::encode_value(bytes, value, header_.order);
+        append(bytes, 1);
+    }
+
+    void write(const std::span<const uint256_t> values) {
+        if (raw_) {
+            append(reinterpret_cast<const std::byte *>(values.data()), values.size());
+            return;
+        }
+        std::byte block[32 * 64];
+        for (std::size_t i = 0; i < values.size(); i += 64) {
+            const std::size_t n = std::min<std::size_t>(64, values.size() - i);
+            for (std::size_t j = 0; j < n; j++) {
+                uint256::detail::encode_value(block + 32 * j, values[i + j], header_.order);
+            }
+            append(block, n);
+        }
+    }
+
+    std::size_t size() const {
+        return (std::size_t)header_.count;
+    }
+
+    // writes the final header and closes the file; throws std::system_error on failure
+    void close() {
+        if (!file_) {
+            return;
+        }
+        std::FILE * const file = std::exchange(file_, nullptr);
+        const std::array<std::byte, uint256::detail::mmap_header_size> header = uint256::detail::encode_mmap_header(header_);
+        bool ok = !std::fseek(file, 0, SEEK_SET) && (std::fwrite(header.data(), 1, header.size(), file) == header.size());
+        const int error = errno;
+        ok = !std::fclose(file) && ok;
+        if (!ok) {
+            throw std::system_error(error ? error : EIO, std::generic_category(), "Error: cannot write uint256_t array file");
+        }
+    }
+
+private:
+    static uint256::byte_order host_order() {
+        uint256::byte_order native;
+        return uint256::detail::native_byte_order(native) ? native : uint256::byte_order::little;
+    }
+
+    void append(const std::byte * data, const std::size_t count) {
+        if (!file_) {
+            throw std::logic_error("Error: uint256_t array writer is closed");
+        }
+        if (std::fwrite(data, 32, count, file_) != count) {
+            throw std::system_error(errno ? errno : EIO, std::generic_category(), "Error: cannot write uint256_t array file");
+        }
+        if (header_.flags & uint256::detail::mmap_flag_checksum) {
+            header_.checksum = uint256::detail::mmap_checksum(header_.checksum, data, count);
+        }
+        header_.count += count;
+    }
+
+    std::FILE * file_;
+    uint256::detail::mmap_header header_;
+    bool raw_ = false;
+};
+
+#endif
@@ -0,0 +1,216 @@
+/*
+uint256_montgomery.h
+Montgomery modular arithmetic for a fixed odd modulus
+
+Values in Montgomery form are a * R mod p with R = 2^256. Products are reduced with the
+coarsely integrated operand scanning (CIOS) method on 64-bit limbs, so the full 512-bit
+product is accumulated without ever being truncated. A context only depends on its
+modulus and can be built at compile time:
+
+    constexpr montgomery_context<uint256_t> field(0xffff...fc2f_u256);
+    static_assert(field.mulmod(2, field.inverse(2)) == 1);
+*/
+
+#if !defined(__UINT256_MONTGOMERY__)
+#define __UINT256_MONTGOMERY__
+
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+
+#include "uint256.h"
+
+template <typename T>
+class montgomery_context;
+
+template <>
+class montgomery_context<uint256_t> {
+public:
+    // modulus must be odd and greater than 1
+    constexpr explicit montgomery_context(const uint256_t & modulus)
+        : p_(modulus), p_limbs_{ modulus.lower().lower(), modulus.lower().upper(), modulus.upper().lower(), modulus.upper().upper() }
+    {
+        if (!(p_limbs_[0] & 1) || (modulus == uint256_1)) {
+            throw std::domain_error("Error: Montgomery modulus must be odd and greater than 1");
+        }
+
+        // -p^-1 mod 2^64 by Newton iteration; p * p == 1 mod 8 gives the first 3 bits
+        uint64_t inv = p_limbs_[0];
+        for (int i = 0; i < 5; i++) {
+            inv *= 2 - p_limbs_[0] * inv;
+        }
+        p_inv_ = -inv;
+
+        // R mod p = (2^256 - p) mod p, then R^2 mod p by 256 modular doublings
+        one_ = (uint256_0 - p_) % p_;
+        r2_ = one_;
+        for (int i = 0; i < 256; i++) {
+            r2_ = addmod(r2_, r2_);
+        }
+    }
+
+    constexpr const uint256_t & modulus() const {
+        return p_;
+    }
+
+    // Montgomery form conversions; a is reduced first
+    constexpr uint256_t to_montgomery(const uint256_t & a) const {
+        return montgomery_mul(reduce(a), r2_);
+    }
+
+    constexpr uint256_t from_montgomery(const uint256_t & a) const {
+        return montgomery_mul(a, uint256_1);
+    }
+
+    // a * b * R^-1 mod p for a, b < p; in Montgomery form this is the product
+    constexpr uint256_t montgomery_mul(const uint256_t & a, const uint256_t & b) const {
+        const uint64_t x[4] = { a.lower().lower(), a.lower().upper(), a.upper().lower(), a.upper().upper() };
+        const uint64_t y[4] = { b.lower().lower(), b.lower().upper(), b.upper().lower(), b.upper().upper() };
+        uint64_t t[6] = { 0, 0, 0, 0, 0, 0 };
+        for (int i = 0; i < 4; i++) {
+            // t += x * y[i]
+            uint64_t c = 0;
+            for (int j = 0; j < 4; j++) {
+                t[j] = uint256::detail::mul_add_64(x[j], y[i], t[j], c, c);
+            }
+            t[4] += c;
+            t[5] = t[4] < c;
+
+            // t = (t + m * p) / 2^64, with m chosen so the low limb cancels
+            const uint64_t m = t[0] * p_inv_;
+            uint256::detail::mul_add_64(m, p_limbs_[0], t[0], 0, c);
+            for (int j = 1; j < 4; j++) {
+                t[j - 1] = uint256::detail::mul_add_64(m, p_limbs_[j], t[j], c, c);
+            }
+            t[3] = t[4] + c;
+            t[4] = t[5] + (t[3] < c);
+        }
+
+        // t < 2p, one conditional subtraction
+        uint64_t d[4], borrow = 0;
+        for (int j = 0; j < 4; j++) {
+            const uint64_t diff = t[j] - p_limbs_[j];
+            const uint64_t b = t[j] < p_limbs_[j];
+            d[j] = diff - borrow;
+            borrow = b | (diff < borrow);
+        }
+        const uint64_t keep = -(uint64_t)(borrow > t[4]);
+        return uint256_t((t[3] & keep) | (d[3] & ~keep), (t[2] & keep) | (d[2] & ~keep),
+                         (t[1] & keep) | (d[1] & ~keep), (t[0] & keep) | (d[0] & ~keep));
+    }
+
+    // Residue arithmetic; inputs must be below the modulus, in either form
+
+    constexpr uint256_t addmod(const uint256_t & a, const uint256_t & b) const {
+        const uint256_t s = a + b;
+        return ((s < a) || (s >= p_)) ? (s - p_) : s;
+    }
+
+    constexpr uint256_t submod(const uint256_t & a, const uint256_t & b) const {
+        return (a < b) ? (a - b + p_) : (a - b);
+    }
+
+    // Plain residues: arguments of any size, results below the modulus
+
+    constexpr uint256_t reduce(const uint256_t & a) const {
+        return (a < p_) ? a : (a % p_);
+    }
+
+    constexpr uint256_t mulmod(const uint256_t & a, const uint256_t & b) const {
+        // (a b R^-1) R^2 R^-1 = a b
+        return montgomery_mul(montgomery_mul(reduce(a), reduce(b)), r2_);
+    }
+
+    // base^exp mod p with a sliding window of up to 4 bits over the exponent
+    constexpr uint256_t powmod(const uint256_t & base, const uint256_t & exp) const {
+        constexpr int window = 4;
+
+        // odd powers b, b^3, ..., b^15 in Montgomery form
+        uint256_t table[1 << (window - 1)];
+        table[0] = to_montgomery(base);
+        const uint256_t square = montgomery_mul(table[0], table[0]);
+        for (int i = 1; i < (1 << (window - 1)); i++) {
+            table[i] = montgomery_mul(table[i - 1], square);
+        }
+
+        const uint64_t e[4] = { exp.lower().lower(), exp.lower().upper(), exp.upper().lower(), exp.upper().upper() };
+        const auto bit = [&e](const int i) -> unsigned int {
+            return (e[i / 64] >> (i % 64)) & 1;
+        };
+
+        uint256_t r = one_;
+        bool started = false;
+        int i = (int)exp.bits() - 1;
+        while (i >= 0) {
+            if (!bit(i)) {
+                if (started) {
+                    r = montgomery_mul(r, r);
+                }
+                i--;
+                continue;
+            }
+            // longest window ending in a set bit
+            int low = (i - window + 1 > 0) ? (i - window + 1) : 0;
+            while (!bit(low)) {
+                low++;
+            }
+            unsigned int value = 0;
+            for (int k = i; k >= low; k--) {
+                value = (value << 1) | bit(k);
+                if (started) {
+                    r = montgomery_mul(r, r);
+                }
+            }
+            r = started ? montgomery_mul(r, table[value >> 1]) : table[value >> 1];
+            started = true;
+            i = low - 1;
+        }
+        return from_montgomery(r);
+    }
+
+    // a^-1 mod p by the binary extended Euclidean algorithm; throws when gcd(a, p) != 1
+    constexpr uint256_t inverse(const uint256_t & a) const {
+        uint256_t u = reduce(a), v = p_;
+        uint256_t x1 = uint256_1, x2 = uint256_0;
+        while ((u != uint256_1) && (v != uint256_1)) {
+            if (!u || !v) {
+                throw std::domain_error("Error: value has no inverse modulo this modulus");
+            }
+            while (!(u.lower().lower() & 1)) {
+                u >>= 1;
+                x1 = half(x1);
+            }
+            while (!(v.lower().lower() & 1)) {
+                v >>= 1;
+                x2 = half(x2);
+            }
+            if (u >= v) {
+                u -= v;
+                x1 = submod(x1, x2);
+            } else {
+                v -= u;
+                x2 = submod(x2, x1);
+            }
+        }
+        return (u == uint256_1) ? x1 : x2;
+    }
+
+private:
+    // x / 2 mod p for x < p
+    constexpr uint256_t half(const uint256_t & x) const {
+        if (!(x.lower().lower() & 1)) {
+            return x >> 1;
+        }
+        // (x + p) / 2 without the 257th bit
+        return (x >> 1) + (p_ >> 1) + uint256_1;
+    }
+
+    uint256_t p_;
+    uint64_t p_limbs_[4];
+    uint64_t p_inv_ = 0;
+    uint256_t one_;
+    uint256_t r2_;
+};
+
+#endif
@@ -0,0 +1,86 @@
+/*
+uint256_parallel.h
+Minimal fork-join helper for the bulk algorithms
+
+parallel_for runs task(i) for every i in [0, tasks) on up to `threads` workers that pull
+task indices from a shared counter, so uneven tasks balance themselves. The calling thread
+is one of the workers. The first exception thrown by a task is rethrown after all workers
+have joined; tasks not yet started are skipped.
+*/
+
+#if !defined(__UINT256_PARALLEL__)
+#define __UINT256_PARALLEL__
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace uint256::detail {
+
+// 0 selects one worker per hardware thread
+inline unsigned int worker_count(const unsigned int threads) {
+    if (threads) {
+        return threads;
+    }
+    const unsigned int hardware = std::thread::hardware_concurrency();
+    return hardware ? hardware : 1;
+}
+
+template <typename Task>
+void parallel_for(const std::size_t tasks, unsigned int threads, Task && task) {
+    threads = worker_count(threads);
+    if (threads > tasks) {
+        threads = (unsigned int)tasks;
+    }
+    if (threads <= 1) {
+        for (std::size_t i = 0; i < tasks; i++) {
+            task(i);
+        }
+        return;
+    }
+
+    std::atomic<std::size_t> next(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    const auto work = [&] {
+        for (std::size_t i = next++; (i < tasks) && !failed.load(std::memory_order_relaxed); i = next++) {
+            try {
+                task(i);
+            } catch (...) {
+                const std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                failed = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    try {
+        for (unsigned int t = 1; t < threads; t++) {
+            workers.emplace_back(work);
+        }
+    } catch (const std::system_error &) {
+        // out of threads: finish with the workers already running
+    }
+    work();
+    for (std::thread & worker : workers) {
+        worker.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,477 @@
+/*
+uint256_soa.h
+Structure-of-arrays container for uint256_t
+
+Each 64-bit limb lives in its own contiguous, 64-byte aligned column, so scans that only
+look at some limbs (e.g. "is the upper half zero") touch only those columns. Elements are
+accessed through a proxy reference; the iterators model std::random_access_iterator so
+the container works with std::ranges algorithms, including sorting.
+*/
+
+#if !defined(__UINT256_SOA__)
+#define __UINT256_SOA__
+
+#pragma once
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "uint256.h"
+
+// element loops only read a[i], b[i] and write out[i]; out may be a or b, but no
+// iteration depends on another, which lets the vectorizer skip its alias checks
+#if defined(__clang__)
+#   define UINT256_T_IVDEP _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+#   define UINT256_T_IVDEP _Pragma("GCC ivdep")
+#else
+#   define UINT256_T_IVDEP
+#endif
+
+namespace uint256::detail {
+
+template <typename T, std::size_t Align>
+struct aligned_allocator {
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = aligned_allocator<U, Align>;
+    };
+
+    aligned_allocator() = default;
+
+    template <typename U>
+    aligned_allocator(const aligned_allocator<U, Align> &) {}
+
+    T * allocate(const std::size_t n) {
+        return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t{ Align }));
+    }
+
+    void deallocate(T * p, const std::size_t) {
+        ::operator delete(p, std::align_val_t{ Align });
+    }
+
+    template <typename U>
+    bool operator==(const aligned_allocator<U, Align> &) const {
+        return true;
+    }
+};
+
+}
+
+class uint256_soa {
+public:
+    // column alignment in bytes; one cache line, which also suits 512-bit loads
+    static constexpr std::size_t alignment = 64;
+
+    using column_type = std::vector<uint64_t, uint256::detail::aligned_allocator<uint64_t, alignment>>;
+    using value_type = uint256_t;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    // proxy for one element; reads and writes go to the four columns
+    class reference {
+    public:
+        reference(const reference &) = default;
+
+        operator uint256_t() const {
+            return owner_->get(index_);
+        }
+
+        const reference & operator=(const uint256_t & value) const {
+            owner_->set(index_, value);
+            return *this;
+        }
+
+        const reference & operator=(const reference & other) const {
+            return *this = static_cast<uint256_t>(other);
+        }
+
+        // limb k, least significant first
+        uint64_t limb(const int k) const {
+            return owner_->columns_[k][index_];
+        }
+
+        friend void swap(const reference a, const reference b) {
+            const uint256_t t = a;
+            a = static_cast<uint256_t>(b);
+            b = t;
+        }
+
+        friend bool operator==(const reference lhs, const reference rhs) {
+            return static_cast<uint256_t>(lhs) == static_cast<uint256_t>(rhs);
+        }
+
+        friend bool operator==(const reference lhs, const uint256_t & rhs) {
+            return static_cast<uint256_t>(lhs) == rhs;
+        }
+
+        friend std::strong_ordering operator<=>(const reference lhs, const reference rhs) {
+            return lhs <=> static_cast<uint256_t>(rhs);
+        }
+
+        friend std::strong_ordering operator<=>(const reference lhs, const uint256_t & rhs) {
+            const uint256_t value = lhs;
+            return (value < rhs) ? std::strong_ordering::less : (rhs < value) ? std::strong_ordering::greater : std::strong_ordering::equal;
+        }
+
+        // builtin integers would otherwise convert either side to uint256_t ambiguously
+        template <std::integral T>
+        friend bool operator==(const reference lhs, const T & rhs) {
+            return lhs == uint256_t(rhs);
+        }
+
+        template <std::integral T>
+        friend std::strong_ordering operator<=>(const reference lhs, const T & rhs) {
+            return lhs <=> uint256_t(rhs);
+        }
+
+    private:
+        friend class uint256_soa;
+
+        reference(uint256_soa * owner, const size_type index)
+            : owner_(owner), index_(index) {}
+
+        uint256_soa * owner_;
+        size_type index_;
+    };
+
+    template <bool Const>
+    class basic_iterator {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = uint256_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<Const, uint256_t, uint256_soa::reference>;
+        using owner_type = std::conditional_t<Const, const uint256_soa, uint256_soa>;
+
+        basic_iterator() = default;
+
+        basic_iterator(owner_type * owner, const size_type index)
+            : owner_(owner), index_(index) {}
+
+        // iterator to const_iterator
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        basic_iterator(const basic_iterator<false> & other)
+            : owner_(other.owner_), index_(other.index_) {}
+
+        reference operator*() const {
+            return (*owner_)[index_];
+        }
+
+        reference operator[](const difference_type n) const {
+            return (*owner_)[index_ + n];
+        }
+
+        basic_iterator & operator++() {
+            index_++;
+            return *this;
+        }
+
+        basic_iterator operator++(int) {
+            basic_iterator t = *this;
+            index_++;
+            return t;
+        }
+
+        basic_iterator & operator--() {
+            index_--;
+            return *this;
+        }
+
+        basic_iterator operator--(int) {
+            basic_iterator t = *this;
+            index_--;
+            return t;
+        }
+
+        basic_iterator & operator+=(const difference_type n) {
+            index_ += n;
+            return *this;
+        }
+
+        basic_iterator & operator-=(const difference_type n) {
+            index_ -= n;
+            return *this;
+        }
+
+        friend basic_iterator operator+(basic_iterator it, const difference_type n) {
+            return it += n;
+        }
+
+        friend basic_iterator operator+(const difference_type n, basic_iterator it) {
+            return it += n;
+        }
+
+        friend basic_iterator operator-(basic_iterator it, const difference_type n) {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const basic_iterator & lhs, const basic_iterator & rhs) {
+            return (difference_type)lhs.index_ - (difference_type)rhs.index_;
+        }
+
+        friend bool operator==(const basic_iterator & lhs, const basic_iterator & rhs) {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend std::strong_ordering operator<=>(const basic_iterator & lhs, const basic_iterator & rhs) {
+            return lhs.index_ <=> rhs.index_;
+        }
+
+        // position in the container
+        size_type index() const {
+            return index_;
+        }
+
+    private:
+        friend class basic_iterator<!Const>;
+
+        owner_type * owner_ = nullptr;
+        size_type index_ = 0;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    uint256_soa() = default;
+
+    explicit uint256_soa(const size_type n) {
+        resize(n);
+    }
+
+    explicit uint256_soa(std::span<const uint256_t> values) {
+        assign(values);
+    }
+
+    uint256_soa(std::initializer_list<uint256_t> values)
+        : uint256_soa(std::span<const uint256_t>(values.begin(), values.size())) {}
+
+    // Capacity
+    size_type size() const {
+        return columns_[0].size();
+    }
+
+    bool empty() const {
+        return columns_[0].empty();
+    }
+
+    void reserve(const size_type n) {
+        for (column_type & c : columns_) {
+            c.reserve(n);
+        }
+    }
+
+    // new elements are zero
+    void resize(const size_type n) {
+        for (column_type & c : columns_) {
+            c.resize(n);
+        }
+    }
+
+    void clear() {
+        for (column_type & c : columns_) {
+            c.clear();
+        }
+    }
+
+    // Modifiers
+    void push_back(const uint256_t & value) {
+        columns_[0].push_back(value.lower().lower());
+        columns_[1].push_back(value.lower().upper());
+        columns_[2].push_back(value.upper().lower());
+        columns_[3].push_back(value.upper().upper());
+    }
+
+    void pop_back() {
+        for (column_type & c : columns_) {
+            c.pop_back();
+        }
+    }
+
+    // replaces the contents with values (array-of-structures to columns)
+    void assign(std::span<const uint256_t> values) {
+        resize(values.size());
+        for (size_type i = 0; i < values.size(); i++) {
+            set(i, values[i]);
+        }
+    }
+
+    // columns to array-of-structures, e.g. to feed the span batch kernels; out must hold size() elements
+    void copy_to(std::span<uint256_t> out) const {
+        if (out.size() != size()) {
+            throw std::invalid_argument("Error: destination size differs from container size");
+        }
+        for (size_type i = 0; i < out.size(); i++) {
+            out[i] = get(i);
+        }
+    }
+
+    // Element access
+    reference operator[](const size_type i) {
+        return reference(this, i);
+    }
+
+    uint256_t operator[](const size_type i) const {
+        return get(i);
+    }
+
+    reference at(const size_type i) {
+        check(i);
+        return reference(this, i);
+    }
+
+    uint256_t at(const size_type i) const {
+        check(i);
+        return get(i);
+    }
+
+    // limb k (0 is least significant) of every element
+    std::span<uint64_t> column(const int k) {
+        return columns_[k];
+    }
+
+    std::span<const uint64_t> column(const int k) const {
+        return columns_[k];
+    }
+
+    // Iterators
+    iterator begin() {
+        return iterator(this, 0);
+    }
+
+    iterator end() {
+        return iterator(this, size());
+    }
+
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const {
+        return const_iterator(this, size());
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+private:
+    uint256_t get(const size_type i) const {
+        return uint256_t(columns_[3][i], columns_[2][i], columns_[1][i], columns_[0][i]);
+    }
+
+    void set(const size_type i, const uint256_t & value) {
+        columns_[0][i] = value.lower().lower();
+        columns_[1][i] = value.lower().upper();
+        columns_[2][i] = value.upper().lower();
+        columns_[3][i] = value.upper().upper();
+    }
+
+    void check(const size_type i) const {
+        if (i >= size()) {
+            throw std::out_of_range("Error: uint256_soa index out of range");
+        }
+    }
+
+    column_type columns_[4];
+};
+
+// the proxy and the value type share uint256_t as their common reference (as vector<bool> does)
+template <template <typename> class TQual, template <typename> class UQual>
+struct std::basic_common_reference<uint256_soa::reference, uint256_t, TQual, UQual> {
+    using type = uint256_t;
+};
+
+template <template <typename> class TQual, template <typename> class UQual>
+struct std::basic_common_reference<uint256_t, uint256_soa::reference, TQual, UQual> {
+    using type = uint256_t;
+};
+
+namespace uint256 {
+
+// Column-wise kernels: each limb column is streamed once and the carry chain runs
+// across columns, so the loops vectorize over elements (e.g. GCC/Clang at -O3 with AVX2)
+
+// out[i] = a[i] + b[i] (mod 2^256); out is resized to match and may be a or b
+inline void add(const uint256_soa & a, const uint256_soa & b, uint256_soa & out) {
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("Error: batch containers differ in size");
+    }
+    const std::size_t n = a.size();
+    out.resize(n);
+    const uint64_t * const a0 = a.column(0).data(), * const a1 = a.column(1).data(), * const a2 = a.column(2).data(), * const a3 = a.column(3).data();
+    const uint64_t * const b0 = b.column(0).data(), * const b1 = b.column(1).data(), * const b2 = b.column(2).data(), * const b3 = b.column(3).data();
+    uint64_t * const o0 = out.column(0).data(), * const o1 = out.column(1).data(), * const o2 = out.column(2).data(), * const o3 = out.column(3).data();
+    UINT256_T_IVDEP
+    for (std::size_t i = 0; i < n; i++) {
+        const uint64_t s0 = a0[i] + b0[i];
+        uint64_t c = s0 < a0[i];
+        const uint64_t t1 = a1[i] + b1[i];
+        const uint64_t s1 = t1 + c;
+        c = (t1 < a1[i]) | (s1 < t1);
+        const uint64_t t2 = a2[i] + b2[i];
+        const uint64_t s2 = t2 + c;
+        c = (t2 < a2[i]) | (s2 < t2);
+        o3[i] = a3[i] + b3[i] + c;
+        o2[i] = s2;
+        o1[i] = s1;
+        o0[i] = s0;
+    }
+}
+
+// out[i] = a[i] - b[i] (mod 2^256); out is resized to match and may be a or b
+inline void sub(const uint256_soa & a, const uint256_soa & b, uint256_soa & out) {
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("Error: batch containers differ in size");
+    }
+    const std::size_t n = a.size();
+    out.resize(n);
+    const uint64_t * const a0 = a.column(0).data(), * const a1 = a.column(1).data(), * const a2 = a.column(2).data(), * const a3 = a.column(3).data();
+    const uint64_t * const b0 = b.column(0).data(), * const b1 = b.column(1).data(), * const b2 = b.column(2).data(), * const b3 = b.column(3).data();
+    uint64_t * const o0 = out.column(0).data(), * const o1 = out.column(1).data(), * const o2 = out.column(2).data(), * const o3 = out.column(3).data();
+    UINT256_T_IVDEP
+    for (std::size_t i = 0; i < n; i++) {
+        const uint64_t d0 = a0[i] - b0[i];
+        uint64_t w = a0[i] < b0[i];
+        const uint64_t t1 = a1[i] - b1[i];
+        const uint64_t d1 = t1 - w;
+        w = (a1[i] < b1[i]) | (t1 < w);
+        const uint64_t t2 = a2[i] - b2[i];
+        const uint64_t d2 = t2 - w;
+        w = (a2[i] < b2[i]) | (t2 < w);
+        o3[i] = a3[i] - b3[i] - w;
+        o2[i] = d2;
+        o1[i] = d1;
+        o0[i] = d0;
+    }
+}
+
+// number of elements that fit in 128 bits; reads only the two upper columns
+inline std::size_t count_fits_128(const uint256_soa & a) {
+    const std::span<const uint64_t> hi = a.column(3), lo = a.column(2);
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < hi.size(); i++) {
+        count += (hi[i] | lo[i]) == 0;
+    }
+    return count;
+}
+
+}
+
+#endif
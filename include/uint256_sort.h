@@ -0,0 +1,264 @@
+/*
+uint256_sort.h
+Radix sorting of uint256_t keys
+
+Keys are sorted most significant byte first: one counting pass and one distribution pass
+per byte, then each bucket is sorted on the next byte. Buckets that fit in cache are
+permuted in place (American flag sort); larger ones are scattered through a scratch buffer
+and copied back, since following the swap cycles through memory stalls on every load.
+Leading bytes shared by every key are skipped up front, buckets that hold a single byte
+value are skipped while recursing, and buckets below radix_cutoff elements finish with a
+comparison sort. Random keys such as hashes are sorted after two or three passes.
+
+parallel_sort scatters on the first distinguishing byte with one histogram per worker,
+then sorts the 256 buckets concurrently. Both sorts allocate a scratch buffer as large as
+the input from scatter_cutoff keys on, and order keys exactly as operator< does.
+
+    std::vector<uint256_t> slots = ...;
+    const std::span<uint256_t> unique = uint256::parallel_sort_unique(slots);
+*/
+
+#if !defined(__UINT256_SORT__)
+#define __UINT256_SORT__
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "uint256.h"
+#include "uint256_parallel.h"
+
+namespace uint256::detail {
+
+// buckets smaller than this are finished by std::sort
+inline constexpr std::size_t radix_cutoff = 64;
+
+// buckets from this size on are scattered through scratch memory instead of permuted in place
+inline constexpr std::size_t scatter_cutoff = std::size_t(1) << 14;
+
+// inputs smaller than this are not worth the threads and the scratch buffer
+inline constexpr std::size_t parallel_sort_cutoff = std::size_t(1) << 16;
+
+// byte in [0, 32), 0 is the least significant
+inline unsigned int radix_digit(const uint256_t & x, const unsigned int byte) {
+    const uint128_t & half = (byte >= 16) ? x.upper() : x.lower();
+    const uint64_t limb = ((byte % 16) >= 8) ? half.upper() : half.lower();
+    return (unsigned int)(limb >> ((byte % 8) * 8)) & 0xff;
+}
+
+// bits where some key differs from the first one
+inline uint256_t radix_difference(const uint256_t * a, const std::size_t n) {
+    uint256_t diff = uint256_0;
+    for (std::size_t i = 1; i < n; i++) {
+        diff |= a[i] ^ a[0];
+    }
+    return diff;
+}
+
+// most significant byte that is not shared by all keys; false if all keys are equal
+inline bool radix_top_byte(const uint256_t & diff, unsigned int & byte) {
+    if (!diff) {
+        return false;
+    }
+    byte = (diff.bits() - 1) / 8;
+    return true;
+}
+
+// uninitialized storage for the out-of-place pass; uint256_t is trivially destructible
+struct radix_scratch {
+    explicit radix_scratch(const std::size_t n)
+        : size(n), data(std::allocator<uint256_t>().allocate(n))
+    {}
+
+    radix_scratch(const radix_scratch &) = delete;
+    radix_scratch & operator=(const radix_scratch &) = delete;
+
+    ~radix_scratch() {
+        std::allocator<uint256_t>().deallocate(data, size);
+    }
+
+    std::size_t size;
+    uint256_t * data;
+};
+
+// scratch is null or holds at least n elements; it is used for buckets of scatter_cutoff keys and more
+inline void radix_sort_msd(uint256_t * a, std::size_t n, unsigned int byte, uint256_t * scratch) {
+    std::array<std::size_t, 256> count;
+    for (;;) {
+        if (n < radix_cutoff) {
+            std::sort(a, a + n);
+            return;
+        }
+        count.fill(0);
+        for (std::size_t i = 0; i < n; i++) {
+            count[radix_digit(a[i], byte)]++;
+        }
+        // every key has the same digit: nothing to permute at this byte
+        if (count[radix_digit(a[0], byte)] != n) {
+            break;
+        }
+        if (!byte) {
+            return;
+        }
+        byte--;
+    }
+
+    std::array<std::size_t, 256> head, tail;
+    std::size_t offset = 0;
+    for (unsigned int d = 0; d < 256; d++) {
+        head[d] = offset;
+        offset += count[d];
+        tail[d] = offset;
+    }
+
+    if (scratch && (n >= scatter_cutoff)) {
+        // out of cache the swap chains below stall on every load; streaming twice is cheaper
+        for (std::size_t i = 0; i < n; i++) {
+            std::construct_at(scratch + head[radix_digit(a[i], byte)]++, a[i]);
+        }
+        std::copy(scratch, scratch + n, a);
+    } else {
+        // cycle each misplaced key into the next free slot of its bucket
+        for (unsigned int d = 0; d < 256; d++) {
+            while (head[d] < tail[d]) {
+                uint256_t v = a[head[d]];
+                unsigned int k = radix_digit(v, byte);
+                while (k != d) {
+                    std::swap(v, a[head[k]++]);
+                    k = radix_digit(v, byte);
+                }
+                a[head[d]++] = v;
+            }
+        }
+    }
+
+    if (!byte) {
+        return;
+    }
+    offset = 0;
+    for (unsigned int d = 0; d < 256; d++) {
+        if (count[d] > 1) {
+            radix_sort_msd(a + offset, count[d], byte - 1, scratch ? (scratch + offset) : nullptr);
+        }
+        offset += count[d];
+    }
+}
+
+}
+
+namespace uint256 {
+
+inline void sort(const std::span<uint256_t> keys) {
+    const std::size_t n = keys.size();
+    unsigned int byte;
+    if ((n < 2) || !uint256::detail::radix_top_byte(uint256::detail::radix_difference(keys.data(), n), byte)) {
+        return;
+    }
+    if (n < uint256::detail::scatter_cutoff) {
+        uint256::detail::radix_sort_msd(keys.data(), n, byte, nullptr);
+        return;
+    }
+    const uint256::detail::radix_scratch scratch(n);
+    uint256::detail::radix_sort_msd(keys.data(), n, byte, scratch.data);
+}
+
+// threads == 0 uses one worker per hardware thread
+inline void parallel_sort(const std::span<uint256_t> keys, unsigned int threads = 0) {
+    const std::size_t n = keys.size();
+    threads = uint256::detail::worker_count(threads);
+    if ((threads <= 1) || (n < uint256::detail::parallel_sort_cutoff)) {
+        sort(keys);
+        return;
+    }
+
+    // contiguous chunks, one per worker
+    const std::size_t chunk = (n + threads - 1) / threads;
+    const auto chunk_begin = [&](const std::size_t c) {
+        return std::min(c * chunk, n);
+    };
+
+    std::vector<uint256_t> diffs(threads);
+    uint256::detail::parallel_for(threads, threads, [&](const std::size_t c) {
+        uint256_t diff = uint256_0;
+        for (std::size_t i = chunk_begin(c); i < chunk_begin(c + 1); i++) {
+            diff |= keys[i] ^ keys[0];
+        }
+        diffs[c] = diff;
+    });
+    unsigned int byte;
+    if (!uint256::detail::radix_top_byte(std::accumulate(diffs.begin(), diffs.end(), uint256_0, std::bit_or<>()), byte)) {
+        return;
+    }
+
+    std::vector<std::array<std::size_t, 256>> counts(threads);
+    uint256::detail::parallel_for(threads, threads, [&](const std::size_t c) {
+        std::array<std::size_t, 256> & count = counts[c];
+        count.fill(0);
+        for (std::size_t i = chunk_begin(c); i < chunk_begin(c + 1); i++) {
+            count[uint256::detail::radix_digit(keys[i], byte)]++;
+        }
+    });
+
+    // bucket d of chunk c starts after all smaller digits and after bucket d of earlier chunks
+    std::array<std::size_t, 257> bucket;
+    std::size_t offset = 0;
+    for (unsigned int d = 0; d < 256; d++) {
+        bucket[d] = offset;
+        for (unsigned int c = 0; c < threads; c++) {
+            const std::size_t count = counts[c][d];
+            counts[c][d] = offset;
+            offset += count;
+        }
+    }
+    bucket[256] = n;
+
+    // the scatter constructs every element of the scratch buffer
+    const uint256::detail::radix_scratch scratch(n);
+    uint256_t * const buffer = scratch.data;
+    uint256::detail::parallel_for(threads, threads, [&](const std::size_t c) {
+        std::array<std::size_t, 256> & next = counts[c];
+        for (std::size_t i = chunk_begin(c); i < chunk_begin(c + 1); i++) {
+            std::construct_at(buffer + next[uint256::detail::radix_digit(keys[i], byte)]++, keys[i]);
+        }
+    });
+
+    // largest buckets first so a skewed distribution does not leave one worker last
+    std::array<unsigned int, 256> order;
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](const unsigned int x, const unsigned int y) {
+        return (bucket[x + 1] - bucket[x]) > (bucket[y + 1] - bucket[y]);
+    });
+    // each bucket moves back first and then uses its own part of the buffer as scratch
+    uint256::detail::parallel_for(256, threads, [&](const std::size_t i) {
+        const unsigned int d = order[i];
+        uint256_t * const first = keys.data() + bucket[d];
+        const std::size_t size = bucket[d + 1] - bucket[d];
+        std::copy(buffer + bucket[d], buffer + bucket[d + 1], first);
+        if (byte && (size > 1)) {
+            uint256::detail::radix_sort_msd(first, size, byte - 1, buffer + bucket[d]);
+        }
+    });
+}
+
+// sorts and moves one copy of each distinct key to the front; returns that prefix
+inline std::span<uint256_t> sort_unique(const std::span<uint256_t> keys) {
+    sort(keys);
+    return keys.first(std::unique(keys.begin(), keys.end()) - keys.begin());
+}
+
+inline std::span<uint256_t> parallel_sort_unique(const std::span<uint256_t> keys, const unsigned int threads = 0) {
+    parallel_sort(keys, threads);
+    return keys.first(std::unique(keys.begin(), keys.end()) - keys.begin());
+}
+
+}
+
+#endif
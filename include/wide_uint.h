@@ -0,0 +1,408 @@
+/*
+wide_uint.h
+Fixed-width unsigned integers of any multiple of 64 bits
+
+wide_uint<Bits> stores its value as std::array<uint64_t, Bits / 64>, least significant
+limb first, and runs every operation on the same limb kernels as uint256_t
+(uint256::detail::add_limbs, mul_limbs, divmod_knuth, ...). The loops have compile-time
+trip counts and are unrolled completely.
+
+    uint512_t p = uint512_t(a) * b;                     // a, b are uint256_t
+    uint1024_t q = mul_wide(uint512_t(a), uint512_t(b));
+
+Conversions from integral types and from uint256_t are implicit and zero (or sign)
+extend; narrowing conversions are explicit and truncate.
+*/
+
+#if !defined(__WIDE_UINT__)
+#define __WIDE_UINT__
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <charconv>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "uint256.h"
+
+namespace uint256::detail {
+
+// built-in integral types; uint128_t and uint256_t also claim std::is_integral
+template <typename T>
+concept builtin_integral = std::integral<T> && !std::is_same_v<T, uint128_t> && !std::is_same_v<T, uint256_t>;
+
+}
+
+template <std::size_t Bits>
+class wide_uint {
+    static_assert((Bits % 64 == 0) && (Bits >= 128), "wide_uint needs a multiple of 64 bits, at least 128");
+
+public:
+    static constexpr std::size_t limb_count = Bits / 64;
+    using limbs_type = std::array<uint64_t, limb_count>;
+
+    wide_uint() = default;
+
+    template <uint256::detail::builtin_integral T>
+    constexpr wide_uint(const T rhs) {
+        limbs_[0] = (uint64_t)rhs;
+        if constexpr (std::is_signed<T>::value) {
+            if (rhs < 0) {
+                for (std::size_t i = 1; i < limb_count; i++) {
+                    limbs_[i] = ~0ULL;
+                }
+            }
+        }
+    }
+
+    constexpr wide_uint(const uint128_t & rhs) {
+        limbs_[0] = rhs.lower();
+        limbs_[1] = rhs.upper();
+    }
+
+    constexpr wide_uint(const uint256_t & rhs) requires (Bits >= 256) {
+        limbs_[0] = rhs.lower().lower();
+        limbs_[1] = rhs.lower().upper();
+        limbs_[2] = rhs.upper().lower();
+        limbs_[3] = rhs.upper().upper();
+    }
+
+    // {high, low} halves, as returned by mul_wide(uint256_t, uint256_t)
+    constexpr wide_uint(const uint256_t & high, const uint256_t & low) requires (Bits == 512)
+        : limbs_{ low.lower().lower(), low.lower().upper(), low.upper().lower(), low.upper().upper(),
+                  high.lower().lower(), high.lower().upper(), high.upper().lower(), high.upper().upper() }
+    {
+    }
+
+    // widening is implicit, narrowing keeps the low limbs
+    template <std::size_t B>
+    constexpr explicit(B > Bits) wide_uint(const wide_uint<B> & rhs) {
+        for (std::size_t i = 0; (i < limb_count) && (i < wide_uint<B>::limb_count); i++) {
+            limbs_[i] = rhs.limbs()[i];
+        }
+    }
+
+    constexpr explicit wide_uint(const limbs_type & limbs)
+        : limbs_(limbs)
+    {
+    }
+
+    // Accessors
+    constexpr const limbs_type & limbs() const {
+        return limbs_;
+    }
+
+    constexpr uint16_t bits() const {
+        for (std::size_t i = limb_count; i > 0; i--) {
+            if (limbs_[i - 1]) {
+                return (uint16_t)((i - 1) * 64 + std::bit_width(limbs_[i - 1]));
+            }
+        }
+        return 0;
+    }
+
+    // Typecast Operators
+    constexpr explicit operator bool() const {
+        uint64_t any = 0;
+        for (const uint64_t l : limbs_) {
+            any |= l;
+        }
+        return any;
+    }
+
+    constexpr explicit operator uint64_t() const {
+        return limbs_[0];
+    }
+
+    // low 256 bits
+    constexpr explicit operator uint256_t() const requires (Bits >= 256) {
+        return uint256_t(limbs_[3], limbs_[2], limbs_[1], limbs_[0]);
+    }
+
+    // Bitwise Operators
+    friend constexpr wide_uint operator&(const wide_uint & lhs, const wide_uint & rhs) {
+        wide_uint r;
+        for (std::size_t i = 0; i < limb_count; i++) {
+            r.limbs_[i] = lhs.limbs_[i] & rhs.limbs_[i];
+        }
+        return r;
+    }
+
+    friend constexpr wide_uint operator|(const wide_uint & lhs, const wide_uint & rhs) {
+        wide_uint r;
+        for (std::size_t i = 0; i < limb_count; i++) {
+            r.limbs_[i] = lhs.limbs_[i] | rhs.limbs_[i];
+        }
+        return r;
+    }
+
+    friend constexpr wide_uint operator^(const wide_uint & lhs, const wide_uint & rhs) {
+        wide_uint r;
+        for (std::size_t i = 0; i < limb_count; i++) {
+            r.limbs_[i] = lhs.limbs_[i] ^ rhs.limbs_[i];
+        }
+        return r;
+    }
+
+    constexpr wide_uint operator~() const {
+        wide_uint r;
+        for (std::size_t i = 0; i < limb_count; i++) {
+            r.limbs_[i] = ~limbs_[i];
+        }
+        return r;
+    }
+
+    // Bitshift Operators; counts of Bits or more (and negative counts) give 0
+    template <uint256::detail::builtin_integral T>
+    friend constexpr wide_uint operator<<(const wide_uint & lhs, const T & rhs) {
+        if constexpr (std::is_signed<T>::value) {
+            if (rhs < 0) {
+                return wide_uint();
+            }
+        }
+        return lhs.shift_left((uint64_t)rhs);
+    }
+
+    template <uint256::detail::builtin_integral T>
+    friend constexpr wide_uint operator>>(const wide_uint & lhs, const T & rhs) {
+        if constexpr (std::is_signed<T>::value) {
+            if (rhs < 0) {
+                return wide_uint();
+            }
+        }
+        return lhs.shift_right((uint64_t)rhs);
+    }
+
+    // Comparison Operators
+    friend constexpr bool operator==(const wide_uint & lhs, const wide_uint & rhs) {
+        uint64_t diff = 0;
+        for (std::size_t i = 0; i < limb_count; i++) {
+            diff |= lhs.limbs_[i] ^ rhs.limbs_[i];
+        }
+        return !diff;
+    }
+
+    friend constexpr std::strong_ordering operator<=>(const wide_uint & lhs, const wide_uint & rhs) {
+        for (std::size_t i = limb_count; i > 1; i--) {
+            if (lhs.limbs_[i - 1] != rhs.limbs_[i - 1]) {
+                return lhs.limbs_[i - 1] <=> rhs.limbs_[i - 1];
+            }
+        }
+        return lhs.limbs_[0] <=> rhs.limbs_[0];
+    }
+
+    // Arithmetic Operators
+    friend constexpr wide_uint operator+(const wide_uint & lhs, const wide_uint & rhs) {
+        wide_uint r;
+        uint256::detail::add_limbs(r.limbs_, lhs.limbs_, rhs.limbs_, 0);
+        return r;
+    }
+
+    friend constexpr wide_uint operator-(const wide_uint & lhs, const wide_uint & rhs) {
+        wide_uint r;
+        uint256::detail::sub_limbs(r.limbs_, lhs.limbs_, rhs.limbs_, 0);
+        return r;
+    }
+
+    friend constexpr wide_uint operator*(const wide_uint & lhs, const wide_uint & rhs) {
+        return wide_uint(uint256::detail::mul_limbs(lhs.limbs_, rhs.limbs_));
+    }
+
+    friend constexpr wide_uint operator/(const wide_uint & lhs, const wide_uint & rhs) {
+        return divmod(lhs, rhs).first;
+    }
+
+    friend constexpr wide_uint operator%(const wide_uint & lhs, const wide_uint & rhs) {
+        return divmod(lhs, rhs).second;
+    }
+
+    constexpr wide_uint operator-() const {
+        return wide_uint() - *this;
+    }
+
+    constexpr wide_uint operator+() const {
+        return *this;
+    }
+
+    template <typename T>
+    constexpr wide_uint & operator&=(const T & rhs) {
+        return *this = *this & rhs;
+    }
+
+    template <typename T>
+    constexpr wide_uint & operator|=(const T & rhs) {
+        return *this = *this | rhs;
+    }
+
+    template <typename T>
+    constexpr wide_uint & operator^=(const T & rhs) {
+        return *this = *this ^ rhs;
+    }
+
+    template <uint256::detail::builtin_integral T>
+    constexpr wide_uint & operator<<=(const T & rhs) {
+        return *this = *this << rhs;
+    }
+
+    template <uint256::detail::builtin_integral T>
+    constexpr wide_uint & operator>>=(const T & rhs) {
+        return *this = *this >> rhs;
+    }
+
+    template <typename T>
+    constexpr wide_uint & operator+=(const T & rhs) {
+        return *this = *this + rhs;
+    }
+
+    template <typename T>
+    constexpr wide_uint & operator-=(const T & rhs) {
+        return *this = *this - rhs;
+    }
+
+    template <typename T>
+    constexpr wide_uint & operator*=(const T & rhs) {
+        return *this = *this * rhs;
+    }
+
+    template <typename T>
+    constexpr wide_uint & operator/=(const T & rhs) {
+        return *this = *this / rhs;
+    }
+
+    template <typename T>
+    constexpr wide_uint & operator%=(const T & rhs) {
+        return *this = *this % rhs;
+    }
+
+    // Increment and Decrement Operators
+    constexpr wide_uint & operator++() {
+        return *this = *this + wide_uint(1);
+    }
+
+    constexpr wide_uint operator++(int) {
+        const wide_uint temp(*this);
+        ++*this;
+        return temp;
+    }
+
+    constexpr wide_uint & operator--() {
+        return *this = *this - wide_uint(1);
+    }
+
+    constexpr wide_uint operator--(int) {
+        const wide_uint temp(*this);
+        --*this;
+        return temp;
+    }
+
+    static constexpr std::pair <wide_uint, wide_uint> divmod(const wide_uint & lhs, const wide_uint & rhs) {
+        const int n = (rhs.bits() + 63) / 64;
+        if (!n) {
+            throw std::domain_error("Error: division or modulus by 0");
+        }
+        if (lhs < rhs) {
+            return std::pair <wide_uint, wide_uint>(wide_uint(), lhs);
+        }
+
+        const int m = (lhs.bits() + 63) / 64;
+        wide_uint q, r;
+        if (n == 1) {
+            uint64_t rem = 0;
+            for (int i = m - 1; i >= 0; i--) {
+                q.limbs_[i] = uint256::detail::div_128_64(rem, lhs.limbs_[i], rhs.limbs_[0], rem);
+            }
+            r.limbs_[0] = rem;
+        } else {
+            uint256::detail::divmod_knuth<(int)limb_count, (int)limb_count>(lhs.limbs_.data(), m, rhs.limbs_.data(), n, q.limbs_.data(), r.limbs_.data());
+        }
+        return std::pair <wide_uint, wide_uint>(q, r);
+    }
+
+    // Get string representation of value
+    constexpr std::string str(uint8_t base = 10, const unsigned int & len = 0) const {
+        if ((base < 2) || (base > 36)) {
+            throw std::invalid_argument("Base must be in the range 2-36");
+        }
+        uint64_t x[limb_count];
+        for (std::size_t i = 0; i < limb_count; i++) {
+            x[i] = limbs_[i];
+        }
+        char buf[Bits];
+        char * const end = buf + sizeof(buf);
+        const char * const begin = std::has_single_bit((unsigned int)base)
+            ? uint256::detail::to_chars_pow2(end, x, std::countr_zero((unsigned int)base))
+            : uint256::detail::to_chars_radix(end, x, base);
+        std::string out(begin, (const char *)end);
+        if (out.size() < len) {
+            out.insert(0, len - out.size(), '0');
+        }
+        return out;
+    }
+
+private:
+    constexpr wide_uint shift_left(const uint64_t s) const {
+        wide_uint r;
+        if (s >= Bits) {
+            return r;
+        }
+        const std::size_t q = s / 64;
+        const unsigned int b = s % 64;
+        for (std::size_t i = q; i < limb_count; i++) {
+            r.limbs_[i] = limbs_[i - q] << b;
+            if (b && (i > q)) {
+                r.limbs_[i] |= limbs_[i - q - 1] >> (64 - b);
+            }
+        }
+        return r;
+    }
+
+    constexpr wide_uint shift_right(const uint64_t s) const {
+        wide_uint r;
+        if (s >= Bits) {
+            return r;
+        }
+        const std::size_t q = s / 64;
+        const unsigned int b = s % 64;
+        for (std::size_t i = 0; i + q < limb_count; i++) {
+            r.limbs_[i] = limbs_[i + q] >> b;
+            if (b && (i + q + 1 < limb_count)) {
+                r.limbs_[i] |= limbs_[i + q + 1] << (64 - b);
+            }
+        }
+        return r;
+    }
+
+    limbs_type limbs_{};
+};
+
+using uint512_t = wide_uint<512>;
+using uint1024_t = wide_uint<1024>;
+
+// Full 2 * Bits product
+template <std::size_t Bits>
+constexpr wide_uint<2 * Bits> mul_wide(const wide_uint<Bits> & lhs, const wide_uint<Bits> & rhs) {
+    return wide_uint<2 * Bits>(uint256::detail::mul_full_limbs(lhs.limbs(), rhs.limbs()));
+}
+
+template <std::size_t Bits>
+std::ostream & operator<<(std::ostream & stream, const wide_uint<Bits> & rhs) {
+    if (stream.flags() & stream.oct) {
+        stream << rhs.str(8);
+    } else if (stream.flags() & stream.dec) {
+        stream << rhs.str(10);
+    } else if (stream.flags() & stream.hex) {
+        stream << rhs.str(16);
+    }
+    return stream;
+}
+
+#endif
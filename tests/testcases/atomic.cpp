@@ -0,0 +1,140 @@
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "uint256_atomic.h"
+#include "uint256_t.h"
+
+static_assert(std::is_trivially_copyable_v<uint256_t>);
+static_assert(alignof(uint256_atomic) == 64);
+static_assert(uint256_aligned_t(uint256_t(6)) * 7 == 42);
+
+namespace {
+
+const uint256_t big(0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL);
+
+}
+
+TEST(Atomic, layout){
+    uint256_t a = big;
+    unsigned char bytes[32];
+    std::memcpy(bytes, &a, sizeof(a));
+    uint256_t b;
+    std::memcpy(&b, bytes, sizeof(b));
+    EXPECT_EQ(b, big);
+
+    const std::vector<uint256_aligned_t> values(5, big);
+    for (const uint256_aligned_t & value : values) {
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&value) % 32, 0u);
+        EXPECT_EQ(value, big);
+    }
+
+    uint256_aligned_t c = 5;
+    c += 3;
+    c = c * big;
+    EXPECT_EQ(c, big * 8);
+    const uint256_t d = c;
+    EXPECT_EQ(d, big << 3);
+}
+
+TEST(Atomic, operations){
+    uint256_atomic v;
+    EXPECT_FALSE(v.is_lock_free());
+    EXPECT_EQ(v.load(), uint256_0);
+
+    v.store(big);
+    EXPECT_EQ(v.load(), big);
+    EXPECT_EQ(v.exchange(uint256_max), big);
+    EXPECT_EQ(v.fetch_add(uint256_1), uint256_max);
+    EXPECT_EQ(v.load(), uint256_0);
+    EXPECT_EQ(v.fetch_sub(uint256_1), uint256_0);
+    EXPECT_EQ(v.load(), uint256_max);
+    EXPECT_EQ(v.fetch_and(big), uint256_max);
+    EXPECT_EQ(v.fetch_or(uint256_1 << 255), big);
+    EXPECT_EQ(v.fetch_xor(big), big | (uint256_1 << 255));
+    EXPECT_EQ(v.load(), uint256_1 << 255);
+
+    uint256_t expected = big;
+    EXPECT_FALSE(v.compare_exchange_strong(expected, uint256_1));
+    EXPECT_EQ(expected, uint256_1 << 255);
+    EXPECT_TRUE(v.compare_exchange_weak(expected, uint256_1));
+    EXPECT_EQ(v.load(), uint256_1);
+
+    EXPECT_EQ(v = big, big);
+    EXPECT_EQ((uint256_t)v, big);
+    EXPECT_EQ(v += uint256_1, big + 1);
+    EXPECT_EQ(v -= big, uint256_1);
+    EXPECT_EQ(v.update([](const uint256_t & x) { return x << 200; }), uint256_1);
+    EXPECT_EQ(v.load(), uint256_1 << 200);
+
+    const uint256_atomic w(big);
+    EXPECT_EQ(w.load(), big);
+}
+
+TEST(Atomic, concurrent_fetch_add){
+    // carries out of every limb
+    const uint256_t step = (uint256_1 << 192) + (uint256_1 << 128) + 0xffffffffffffffffULL;
+    const unsigned int threads = 4, adds = 20000;
+    uint256_atomic total;
+    std::vector<std::thread> workers;
+    for (unsigned int t = 0; t < threads; t++) {
+        workers.emplace_back([&] {
+            for (unsigned int i = 0; i < adds; i++) {
+                (void)total.fetch_add(step);
+            }
+        });
+    }
+    for (std::thread & worker : workers) {
+        worker.join();
+    }
+    EXPECT_EQ(total.load(), step * (threads * adds));
+}
+
+TEST(Atomic, concurrent_compare_exchange){
+    const unsigned int threads = 4, increments = 10000;
+    uint256_atomic count(uint256_max - 100);
+    std::vector<std::thread> workers;
+    for (unsigned int t = 0; t < threads; t++) {
+        workers.emplace_back([&] {
+            for (unsigned int i = 0; i < increments; i++) {
+                uint256_t expected = count.load();
+                while (!count.compare_exchange_weak(expected, expected + 1)) {}
+            }
+        });
+    }
+    for (std::thread & worker : workers) {
+        worker.join();
+    }
+    EXPECT_EQ(count.load(), uint256_t(threads * increments - 101));
+}
+
+TEST(Atomic, no_torn_reads){
+    // every stored value has four equal limbs, so a mix of two stores is easy to spot
+    uint256_atomic v;
+    std::atomic<bool> done{ false };
+    std::vector<std::thread> writers;
+    for (uint64_t t = 1; t <= 2; t++) {
+        writers.emplace_back([&, t] {
+            for (uint64_t i = 0; i < 20000; i++) {
+                const uint64_t x = (t << 32) | i;
+                v.store(uint256_t(x, x, x, x));
+            }
+        });
+    }
+    std::thread reader([&] {
+        while (!done.load()) {
+            const uint256_t x = v.load();
+            const uint64_t limb = x.lower().lower();
+            ASSERT_EQ(x, uint256_t(limb, limb, limb, limb));
+        }
+    });
+    for (std::thread & writer : writers) {
+        writer.join();
+    }
+    done = true;
+    reader.join();
+}
@@ -0,0 +1,122 @@
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "uint256_batch.h"
+
+// random limbs mixed with 0 and all-ones limbs so carry and borrow chains are exercised
+static std::vector<uint256_t> values(const std::size_t n, const uint64_t seed) {
+    std::mt19937_64 gen(seed);
+    const auto limb = [&gen]() -> uint64_t {
+        switch (gen() % 4) {
+            case 0:  return 0;
+            case 1:  return ~0ULL;
+            default: return gen();
+        }
+    };
+    std::vector<uint256_t> out;
+    for (std::size_t i = 0; i < n; i++) {
+        out.emplace_back(limb(), limb(), limb(), limb());
+    }
+    // equal neighbours for equal/less
+    for (std::size_t i = 1; i < n; i += 7) {
+        out[i] = out[i - 1];
+    }
+    return out;
+}
+
+static std::vector<uint256::batch_isa> supported() {
+    std::vector<uint256::batch_isa> out;
+    for (const uint256::batch_isa isa : { uint256::batch_isa::scalar, uint256::batch_isa::avx2, uint256::batch_isa::avx512 }) {
+        if (uint256::batch_isa_supported(isa)) {
+            out.push_back(isa);
+        }
+    }
+    return out;
+}
+
+TEST(Batch, elementwise){
+    const std::size_t n = 1001;
+    const std::vector<uint256_t> a = values(n, 1);
+    std::vector<uint256_t> b = values(n, 2);
+    for (std::size_t i = 3; i < n; i += 11) {
+        b[i] = a[i];
+    }
+
+    for (const uint256::batch_isa isa : supported()) {
+        const uint256::detail::batch_kernels & k = uint256::detail::kernels_for(isa);
+        std::vector<uint256_t> out(n);
+        std::unique_ptr<bool[]> flags(new bool[n]);
+
+        k.add(a.data(), b.data(), out.data(), n);
+        for (std::size_t i = 0; i < n; i++) {
+            ASSERT_EQ(out[i], a[i] + b[i]) << "isa " << (int)isa << " index " << i;
+        }
+        k.sub(a.data(), b.data(), out.data(), n);
+        for (std::size_t i = 0; i < n; i++) {
+            ASSERT_EQ(out[i], a[i] - b[i]) << "isa " << (int)isa << " index " << i;
+        }
+        k.min(a.data(), b.data(), out.data(), n);
+        for (std::size_t i = 0; i < n; i++) {
+            ASSERT_EQ(out[i], (b[i] < a[i]) ? b[i] : a[i]) << "isa " << (int)isa << " index " << i;
+        }
+        k.max(a.data(), b.data(), out.data(), n);
+        for (std::size_t i = 0; i < n; i++) {
+            ASSERT_EQ(out[i], (a[i] < b[i]) ? b[i] : a[i]) << "isa " << (int)isa << " index " << i;
+        }
+        k.equal(a.data(), b.data(), flags.get(), n);
+        for (std::size_t i = 0; i < n; i++) {
+            ASSERT_EQ(flags[i], a[i] == b[i]) << "isa " << (int)isa << " index " << i;
+        }
+        k.less(a.data(), b.data(), flags.get(), n);
+        for (std::size_t i = 0; i < n; i++) {
+            ASSERT_EQ(flags[i], a[i] < b[i]) << "isa " << (int)isa << " index " << i;
+        }
+    }
+}
+
+TEST(Batch, sum){
+    for (const std::size_t n : { 0, 1, 2, 3, 1000 }) {
+        const std::vector<uint256_t> a = values(n, 3);
+        const std::pair <uint256_t, uint64_t> expected = uint256::detail::sum_scalar(a.data(), n);
+        for (const uint256::batch_isa isa : supported()) {
+            const std::pair <uint256_t, uint64_t> got = uint256::detail::kernels_for(isa).sum(a.data(), n);
+            EXPECT_EQ(got.first, expected.first) << "isa " << (int)isa << " n " << n;
+            EXPECT_EQ(got.second, expected.second) << "isa " << (int)isa << " n " << n;
+        }
+    }
+
+    const std::vector<uint256_t> maxes(5, uint256_max);
+    const std::pair <uint256_t, uint64_t> s = uint256::sum(maxes);
+    EXPECT_EQ(s.first, uint256_max - 4);
+    EXPECT_EQ(s.second, 4);
+}
+
+TEST(Batch, public_api){
+    std::vector<uint256_t> a = { 1, uint256_max, 5 };
+    const std::vector<uint256_t> b = { 2, 1, 5 };
+
+    std::vector<uint256_t> out(3);
+    uint256::add(a, b, out);
+    EXPECT_EQ(out, (std::vector<uint256_t>{ 3, 0, 10 }));
+
+    // in place
+    uint256::sub(a, b, a);
+    EXPECT_EQ(a, (std::vector<uint256_t>{ uint256_max, uint256_max - 1, 0 }));
+
+    bool flags[3];
+    uint256::less(b, out, flags);
+    EXPECT_TRUE(flags[0]);
+    EXPECT_FALSE(flags[1]);
+    EXPECT_TRUE(flags[2]);
+
+    EXPECT_EQ(uint256::min(std::span<const uint256_t>(b)), 1);
+    EXPECT_EQ(uint256::max(std::span<const uint256_t>(b)), 5);
+    EXPECT_EQ(uint256::min(std::span<const uint256_t>()), uint256_max);
+    EXPECT_EQ(uint256::max(std::span<const uint256_t>()), 0);
+
+    std::vector<uint256_t> short_out(2);
+    EXPECT_THROW(uint256::add(a, b, short_out), std::invalid_argument);
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+TEST(Bit, countl_zero){
+    EXPECT_EQ(countl_zero(uint256_t(0)), 256);
+    EXPECT_EQ(countl_zero(uint256_max), 0);
+
+    uint256_t value = 1;
+    for(int i = 0; i < 256; i++){
+        EXPECT_EQ(countl_zero(value), 255 - i);
+        value <<= 1;
+    }
+}
+
+TEST(Bit, countl_one){
+    EXPECT_EQ(countl_one(uint256_t(0)), 0);
+    EXPECT_EQ(countl_one(uint256_max), 256);
+    EXPECT_EQ(countl_one(uint256_t(0xffffffffffffffffULL, 0xf000000000000000ULL, 0, 0)), 68);
+}
+
+TEST(Bit, countr_zero){
+    EXPECT_EQ(countr_zero(uint256_t(0)), 256);
+    EXPECT_EQ(countr_zero(uint256_max), 0);
+
+    uint256_t value = 1;
+    for(int i = 0; i < 256; i++){
+        EXPECT_EQ(countr_zero(value), i);
+        value <<= 1;
+    }
+}
+
+TEST(Bit, countr_one){
+    EXPECT_EQ(countr_one(uint256_t(0)), 0);
+    EXPECT_EQ(countr_one(uint256_max), 256);
+    EXPECT_EQ(countr_one(uint256_t(0, 0, 0x1ULL, 0xffffffffffffffffULL)), 65);
+}
+
+TEST(Bit, popcount){
+    EXPECT_EQ(popcount(uint256_t(0)), 0);
+    EXPECT_EQ(popcount(uint256_max), 256);
+    EXPECT_EQ(popcount(uint256_t(0xf0f0f0f0f0f0f0f0ULL, 0x1ULL, 0x3ULL, 0x7ULL)), 38);
+}
+
+TEST(Bit, bit_width){
+    EXPECT_EQ(bit_width(uint256_t(0)), 0);
+    EXPECT_EQ(bit_width(uint256_t(1)), 1);
+    EXPECT_EQ(bit_width(uint256_max), 256);
+    EXPECT_EQ(bit_width(uint256_t(0, 0x1ULL, 0, 0)), 129);
+}
+
+TEST(Bit, has_single_bit){
+    EXPECT_EQ(has_single_bit(uint256_t(0)), false);
+    EXPECT_EQ(has_single_bit(uint256_t(1) << 200), true);
+    EXPECT_EQ(has_single_bit(uint256_t(3) << 100), false);
+}
+
+TEST(Bit, rotl){
+    const uint256_t val(0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL);
+
+    EXPECT_EQ(rotl(val, 0),   val);
+    EXPECT_EQ(rotl(val, 256), val);
+    EXPECT_EQ(rotl(val, 64),  uint256_t(0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL, 0x0123456789abcdefULL));
+    EXPECT_EQ(rotl(val, 4),   uint256_t(0x123456789abcdeffULL, 0xedcba98765432100ULL, 0xf1e2d3c4b5a69788ULL, 0x796a5b4c3d2e1f00ULL));
+    EXPECT_EQ(rotl(val, -4),  rotr(val, 4));
+    EXPECT_EQ(rotl(uint256_1 << 255, 1), 1);
+}
+
+TEST(Bit, rotr){
+    const uint256_t val(0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL);
+
+    EXPECT_EQ(rotr(val, 0),   val);
+    EXPECT_EQ(rotr(val, 128), uint256_t(0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL, 0x0123456789abcdefULL, 0xfedcba9876543210ULL));
+    EXPECT_EQ(rotr(val, 4),   uint256_t(0x00123456789abcdeULL, 0xffedcba987654321ULL, 0x00f1e2d3c4b5a697ULL, 0x88796a5b4c3d2e1fULL));
+    EXPECT_EQ(rotr(val, 300), rotr(val, 44));
+    EXPECT_EQ(rotr(uint256_t(1), 1), uint256_1 << 255);
+}
@@ -0,0 +1,54 @@
+#include <array>
+#include <cstddef>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+static constexpr uint256_t value(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL, 0x1011121314151617ULL, 0x18191a1b1c1d1e1fULL);
+
+TEST(Bytes, big_endian){
+    const std::array<std::byte, 32> be = value.to_bytes_be();
+    for (int i = 0; i < 32; i++) {
+        EXPECT_EQ(be[i], (std::byte)i);
+    }
+    EXPECT_EQ(uint256_t::from_bytes_be(be), value);
+
+    // matches the byte vector interface
+    const std::vector<uint8_t> bits = value.export_bits();
+    for (int i = 0; i < 32; i++) {
+        EXPECT_EQ(bits[i], (uint8_t)be[i]);
+    }
+}
+
+TEST(Bytes, little_endian){
+    const std::array<std::byte, 32> le = value.to_bytes_le();
+    for (int i = 0; i < 32; i++) {
+        EXPECT_EQ(le[i], (std::byte)(31 - i));
+    }
+    EXPECT_EQ(uint256_t::from_bytes_le(le), value);
+}
+
+TEST(Bytes, span){
+    std::mt19937_64 gen(11);
+    std::array<std::byte, 64> buf{};
+    for (int i = 0; i < 100; i++) {
+        const uint256_t x(gen(), gen(), gen(), gen());
+        const std::span<std::byte, 32> first(buf.data(), 32);
+        const std::span<std::byte, 32> second(buf.data() + 32, 32);
+        x.to_bytes_be(first);
+        x.to_bytes_le(second);
+        EXPECT_EQ(uint256_t::from_bytes_be(std::span<const std::byte, 32>(buf.data(), 32)), x);
+        EXPECT_EQ(uint256_t::from_bytes_le(std::span<const std::byte, 32>(buf.data() + 32, 32)), x);
+    }
+}
+
+TEST(Bytes, compile_time){
+    static_assert(value.to_bytes_be()[31] == std::byte{ 0x1f });
+    static_assert(value.to_bytes_le()[31] == std::byte{ 0x00 });
+    static_assert(uint256_t::from_bytes_be(value.to_bytes_be()) == value);
+    static_assert(uint256_t::from_bytes_le(value.to_bytes_le()) == value);
+    static_assert(uint256_t(0x1234).export_bits_truncate().size() == 2);
+    static_assert(uint256_0.export_bits_truncate().empty());
+}
@@ -0,0 +1,63 @@
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+TEST(Carry, addc){
+    EXPECT_EQ(addc(1, 2, false), std::make_pair(uint256_t(3), false));
+    EXPECT_EQ(addc(1, 2, true), std::make_pair(uint256_t(4), false));
+    EXPECT_EQ(addc(uint256_max, 0, true), std::make_pair(uint256_0, true));
+    EXPECT_EQ(addc(uint256_max, uint256_max, true), std::make_pair(uint256_max, true));
+    // carry rippling across every limb
+    EXPECT_EQ(addc(uint256_t(0, 0, uint64_t(-1), uint64_t(-1)), 0, true), std::make_pair(uint256_1 << 128, false));
+    static_assert(addc(uint256_max, 1, false).second);
+    static_assert(addc(uint256_max - 1, 0, true) == std::make_pair(uint256_max, false));
+}
+
+TEST(Carry, subb){
+    EXPECT_EQ(subb(3, 2, false), std::make_pair(uint256_1, false));
+    EXPECT_EQ(subb(3, 2, true), std::make_pair(uint256_0, false));
+    EXPECT_EQ(subb(0, 0, true), std::make_pair(uint256_max, true));
+    EXPECT_EQ(subb(uint256_max, uint256_max, true), std::make_pair(uint256_max, true));
+    EXPECT_EQ(subb(uint256_1 << 192, 0, true), std::make_pair(uint256_t(0, uint64_t(-1), uint64_t(-1), uint64_t(-1)), false));
+    static_assert(subb(0, 1, false).second);
+    static_assert(subb(1, 0, true) == std::make_pair(uint256_0, false));
+}
+
+TEST(Carry, random){
+    std::mt19937_64 gen(17);
+    for (int i = 0; i < 1000; i++) {
+        const uint256_t a(gen(), gen(), gen(), gen()), b(gen(), gen(), gen(), gen());
+        const bool c = gen() & 1;
+
+        const std::pair <uint256_t, bool> sum = addc(a, b, c);
+        EXPECT_EQ(sum.first, a + b + uint256_t(c));
+        EXPECT_EQ(sum.second, add_overflow(a, b).second || add_overflow(a + b, uint256_t(c)).second);
+
+        const std::pair <uint256_t, bool> diff = subb(a, b, c);
+        EXPECT_EQ(diff.first, a - b - uint256_t(c));
+        EXPECT_EQ(diff.second, (a < b) || ((a == b) && c));
+    }
+}
+
+TEST(Carry, chain){
+    // 512-bit (high, low) words: (2^256 - 1) + 1 carries into the high word
+    const std::pair <uint256_t, bool> lo = addc(uint256_max, 1, false);
+    const std::pair <uint256_t, bool> hi = addc(5, 7, lo.second);
+    EXPECT_EQ(lo.first, 0);
+    EXPECT_EQ(hi, std::make_pair(uint256_t(13), false));
+
+    // and back again
+    const std::pair <uint256_t, bool> dlo = subb(lo.first, 1, false);
+    const std::pair <uint256_t, bool> dhi = subb(hi.first, 7, dlo.second);
+    EXPECT_EQ(dlo.first, uint256_max);
+    EXPECT_EQ(dhi, std::make_pair(uint256_t(5), false));
+
+    // a * b + a * b on the full 512-bit product
+    const std::pair <uint256_t, uint256_t> p = mul_wide(uint256_max, uint256_max);
+    const std::pair <uint256_t, bool> l = addc(p.second, p.second, false);
+    const std::pair <uint256_t, bool> h = addc(p.first, p.first, l.second);
+    EXPECT_EQ(l.first, 2);
+    EXPECT_EQ(h, std::make_pair(uint256_max - 3, true));
+}
@@ -0,0 +1,183 @@
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "uint256_compact.h"
+
+namespace {
+
+std::vector<uint8_t> leb128(const uint256_t & x) {
+    std::byte buf[uint256::leb128_max_size];
+    const uint256::encode_result res = uint256::encode_leb128(buf, buf + sizeof(buf), x);
+    EXPECT_EQ(res.ec, std::errc{});
+    return std::vector<uint8_t>((const uint8_t *)buf, (const uint8_t *)res.ptr);
+}
+
+std::vector<uint8_t> rlp(const uint256_t & x) {
+    std::byte buf[uint256::rlp_max_size];
+    const uint256::encode_result res = uint256::encode_rlp(buf, buf + sizeof(buf), x);
+    EXPECT_EQ(res.ec, std::errc{});
+    return std::vector<uint8_t>((const uint8_t *)buf, (const uint8_t *)res.ptr);
+}
+
+uint256::decode_result decode_leb128(const std::vector<uint8_t> & in, uint256_t & x) {
+    const std::byte * p = (const std::byte *)in.data();
+    return uint256::decode_leb128(p, p + in.size(), x);
+}
+
+uint256::decode_result decode_rlp(const std::vector<uint8_t> & in, uint256_t & x) {
+    const std::byte * p = (const std::byte *)in.data();
+    return uint256::decode_rlp(p, p + in.size(), x);
+}
+
+std::vector<uint256_t> values(const std::size_t n) {
+    std::mt19937_64 gen(25);
+    std::vector<uint256_t> out = { 0, 1, 0x7f, 0x80, 0xff, 0x100, uint256_max, uint256_1 << 63, uint256_1 << 64, uint256_1 << 255 };
+    for (std::size_t i = 0; i < n; i++) {
+        const uint256_t x(gen(), gen(), gen(), gen());
+        out.push_back(x >> (unsigned int)(gen() % 256));
+    }
+    return out;
+}
+
+}
+
+TEST(Compact, leb128_vectors){
+    EXPECT_EQ(leb128(0), std::vector<uint8_t>({ 0x00 }));
+    EXPECT_EQ(leb128(1), std::vector<uint8_t>({ 0x01 }));
+    EXPECT_EQ(leb128(127), std::vector<uint8_t>({ 0x7f }));
+    EXPECT_EQ(leb128(128), std::vector<uint8_t>({ 0x80, 0x01 }));
+    EXPECT_EQ(leb128(624485), std::vector<uint8_t>({ 0xe5, 0x8e, 0x26 }));
+    EXPECT_EQ(leb128(uint256_1 << 64), std::vector<uint8_t>({ 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02 }));
+
+    std::vector<uint8_t> max(36, 0xff);
+    max.push_back(0x0f);
+    EXPECT_EQ(leb128(uint256_max), max);
+    EXPECT_EQ(uint256::leb128_size(uint256_max), 37u);
+    EXPECT_EQ(uint256::leb128_size((uint64_t)-1), 10u);
+}
+
+TEST(Compact, rlp_vectors){
+    EXPECT_EQ(rlp(0), std::vector<uint8_t>({ 0x80 }));
+    EXPECT_EQ(rlp(1), std::vector<uint8_t>({ 0x01 }));
+    EXPECT_EQ(rlp(0x7f), std::vector<uint8_t>({ 0x7f }));
+    EXPECT_EQ(rlp(0x80), std::vector<uint8_t>({ 0x81, 0x80 }));
+    EXPECT_EQ(rlp(1024), std::vector<uint8_t>({ 0x82, 0x04, 0x00 }));
+    EXPECT_EQ(rlp(uint256_1 << 64), std::vector<uint8_t>({ 0x89, 0x01, 0, 0, 0, 0, 0, 0, 0, 0 }));
+
+    std::vector<uint8_t> max(33, 0xff);
+    max[0] = 0xa0;
+    EXPECT_EQ(rlp(uint256_max), max);
+}
+
+TEST(Compact, round_trip){
+    for (const uint256_t & x : values(2000)) {
+        uint256_t y;
+        const std::vector<uint8_t> a = leb128(x);
+        EXPECT_EQ(a.size(), uint256::leb128_size(x));
+        const uint256::decode_result ra = decode_leb128(a, y);
+        EXPECT_EQ(ra.ec, std::errc{});
+        EXPECT_EQ(ra.ptr, (const std::byte *)a.data() + a.size());
+        EXPECT_EQ(y, x);
+
+        const std::vector<uint8_t> b = rlp(x);
+        EXPECT_EQ(b.size(), uint256::rlp_size(x));
+        const uint256::decode_result rb = decode_rlp(b, y);
+        EXPECT_EQ(rb.ec, std::errc{});
+        EXPECT_EQ(rb.ptr, (const std::byte *)b.data() + b.size());
+        EXPECT_EQ(y, x);
+    }
+}
+
+TEST(Compact, short_buffers){
+    std::byte buf[40];
+    for (const uint256_t & x : { uint256_t(300), uint256_max }) {
+        const std::size_t leb = uint256::leb128_size(x), r = uint256::rlp_size(x);
+        EXPECT_EQ(uint256::encode_leb128(buf, buf + leb - 1, x).ec, std::errc::value_too_large);
+        EXPECT_EQ(uint256::encode_leb128(buf, buf + leb - 1, x).ptr, buf + leb - 1);
+        EXPECT_EQ(uint256::encode_rlp(buf, buf + r - 1, x).ec, std::errc::value_too_large);
+    }
+    EXPECT_EQ(uint256::encode_leb128(buf, buf, 0).ec, std::errc::value_too_large);
+}
+
+TEST(Compact, leb128_errors){
+    uint256_t x = 42;
+    EXPECT_EQ(decode_leb128({}, x).ec, std::errc::invalid_argument);
+    EXPECT_EQ(decode_leb128({ 0x80 }, x).ec, std::errc::invalid_argument);
+    EXPECT_EQ(decode_leb128(std::vector<uint8_t>(20, 0xff), x).ec, std::errc::invalid_argument);
+
+    // 2^256 and a set bit beyond it
+    std::vector<uint8_t> over(36, 0x80);
+    over.push_back(0x10);
+    EXPECT_EQ(decode_leb128(over, x).ec, std::errc::result_out_of_range);
+    std::vector<uint8_t> far(37, 0x80);
+    far.push_back(0x01);
+    EXPECT_EQ(decode_leb128(far, x).ec, std::errc::result_out_of_range);
+    EXPECT_EQ(x, 42);
+
+    // zero padding is accepted up to the longest encoding
+    std::vector<uint8_t> padded = { 0x81, 0x80, 0x80, 0x00 };
+    EXPECT_EQ(decode_leb128(padded, x).ec, std::errc{});
+    EXPECT_EQ(x, 1);
+    std::vector<uint8_t> long_padding(36, 0x80);
+    long_padding[0] = 0x85;
+    long_padding.push_back(0x00);
+    EXPECT_EQ(decode_leb128(long_padding, x).ec, std::errc{});
+    EXPECT_EQ(x, 5);
+}
+
+TEST(Compact, rlp_errors){
+    uint256_t x = 42;
+    EXPECT_EQ(decode_rlp({}, x).ec, std::errc::invalid_argument);
+    // truncated, leading zero, prefixed single byte, list and long string forms
+    EXPECT_EQ(decode_rlp({ 0x82, 0x01 }, x).ec, std::errc::invalid_argument);
+    EXPECT_EQ(decode_rlp({ 0x82, 0x00, 0x01 }, x).ec, std::errc::invalid_argument);
+    EXPECT_EQ(decode_rlp({ 0x81, 0x05 }, x).ec, std::errc::invalid_argument);
+    EXPECT_EQ(decode_rlp({ 0xc0 }, x).ec, std::errc::invalid_argument);
+    EXPECT_EQ(decode_rlp({ 0xb8, 0x01 }, x).ec, std::errc::invalid_argument);
+    std::vector<uint8_t> wide(34, 0xff);
+    wide[0] = 0xa1;
+    EXPECT_EQ(decode_rlp(wide, x).ec, std::errc::result_out_of_range);
+    EXPECT_EQ(x, 42);
+
+    EXPECT_EQ(decode_rlp({ 0x80 }, x).ec, std::errc{});
+    EXPECT_EQ(x, 0);
+}
+
+TEST(Compact, batch){
+    const std::vector<uint256_t> in = values(500);
+    for (const bool use_rlp : { false, true }) {
+        const std::size_t size = use_rlp ? uint256::rlp_size(in) : uint256::leb128_size(in);
+        std::vector<std::byte> buf(size);
+        const uint256::encode_result enc = use_rlp ? uint256::encode_rlp(in, buf) : uint256::encode_leb128(in, buf);
+        EXPECT_EQ(enc.ec, std::errc{});
+        EXPECT_EQ(enc.ptr, buf.data() + size);
+
+        std::vector<uint256_t> out(in.size());
+        const uint256::decode_result dec = use_rlp ? uint256::decode_rlp(buf, out) : uint256::decode_leb128(buf, out);
+        EXPECT_EQ(dec.ec, std::errc{});
+        EXPECT_EQ(dec.ptr, buf.data() + size);
+        EXPECT_EQ(out, in);
+
+        // short output stops at a value boundary
+        std::vector<std::byte> small(size - 1);
+        const uint256::encode_result cut = use_rlp ? uint256::encode_rlp(in, small) : uint256::encode_leb128(in, small);
+        EXPECT_EQ(cut.ec, std::errc::value_too_large);
+        const std::size_t last = use_rlp ? uint256::rlp_size(in.back()) : uint256::leb128_size(in.back());
+        EXPECT_EQ(cut.ptr, small.data() + size - last);
+    }
+}
+
+TEST(Compact, constexpr){
+    constexpr auto round_trip = [](const uint256_t & x) {
+        std::byte buf[uint256::leb128_max_size]{};
+        uint256::encode_leb128(buf, buf + sizeof(buf), x);
+        uint256_t y;
+        uint256::decode_leb128(buf, buf + sizeof(buf), y);
+        return y;
+    };
+    static_assert(round_trip(uint256_max) == uint256_max);
+    static_assert(round_trip(300) == 300);
+    static_assert(uint256::rlp_size(uint256_1 << 200) == 27);
+}
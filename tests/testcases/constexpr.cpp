@@ -0,0 +1,26 @@
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+// everything below is evaluated by the compiler
+static constexpr uint256_t a(0xfedcba9876543210ULL, 0x0123456789abcdefULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL);
+static constexpr uint256_t b(0x0000000000000000ULL, 0x1122334455667788ULL, 0x99aabbccddeeff00ULL, 0xffeeddccbbaa9988ULL);
+
+static_assert(uint256_max + uint256_1 == uint256_0);
+static_assert(uint256_0 - uint256_1 == uint256_max);
+static_assert((uint256_1 << 255) >> 255 == uint256_1);
+static_assert((a * b) / b != uint256_0);
+static_assert((a / b) * b + (a % b) == a);
+static_assert(uint256_t(1000000007) * uint256_t(998244353) == uint256_t(998244359987710471ULL));
+static_assert(uint256_t("115792089237316195423570985008687907853269984665640564039457584007913129639935", 10) == uint256_max);
+static_assert(uint256_t::divmod(a, (uint64_t) 0x89abcdefULL).second == 0x000000000305e581ULL);
+static_assert(a.bits() == 256);
+static_assert(countr_zero(uint256_1 << 200) == 200);
+
+TEST(Constexpr, evaluation){
+    constexpr uint256_t squared = b * b;
+    EXPECT_EQ(squared, b * b);
+
+    constexpr bool round_trip = uint256_t(a.str(16), 16) == a;
+    EXPECT_TRUE(round_trip);
+}
@@ -15,6 +15,22 @@ TEST(Arithmetic, divide){
     EXPECT_THROW(uint256_t(1) / uint256_t(0), std::domain_error);
 }
 
+TEST(Arithmetic, divide_multi_limb){
+    const uint256_t val(0xfedcba9876543210ULL, 0x0123456789abcdefULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL);
+
+    // 192 bit divisor
+    EXPECT_EQ(val / uint256_t(0x0000000000000000ULL, 0x1122334455667788ULL, 0x99aabbccddeeff00ULL, 0xffeeddccbbaa9988ULL),
+              uint256_t(0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000000000000eULL, 0xe000000000000001ULL));
+
+    // 128 bit divisor with a top limb that triggers the qhat correction
+    EXPECT_EQ(val / uint256_t(0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffffffeULL, 0xffffffffffffffffULL),
+              uint256_t(0x0000000000000000ULL, 0x0000000000000000ULL, 0xfedcba9876543211ULL, 0x0000000000000001ULL));
+
+    // single limb divisor
+    EXPECT_EQ(val / uint256_t(0x89abcdefULL),
+              uint256_t(0x00000001d9ead7d0ULL, 0xe90ac0e3efe4c1c5ULL, 0xfd8a449528234ef6ULL, 0x4a14877a45a03981ULL));
+}
+
 TEST(External, divide){
     bool      t    = true;
     bool      f    = false;
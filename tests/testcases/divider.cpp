@@ -0,0 +1,71 @@
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "uint256_divider.h"
+
+static void check(const uint256_t & n, const uint256_t & d) {
+    const uint256_divider divider(d);
+    const std::pair <uint256_t, uint256_t> expected = uint256_t::divmod(n, d);
+    EXPECT_EQ(n / divider, expected.first) << n << " / " << d;
+    EXPECT_EQ(n % divider, expected.second) << n << " % " << d;
+    EXPECT_EQ(divider.divmod(n), expected) << n << " / " << d;
+}
+
+TEST(Divider, random){
+    std::mt19937_64 gen(18);
+    for (int i = 0; i < 2000; i++) {
+        uint256_t n(gen(), gen(), gen(), gen()), d(gen(), gen(), gen(), gen());
+        n >>= (unsigned int)(gen() % 256);
+        d >>= (unsigned int)(gen() % 256);
+        if (!d) {
+            continue;
+        }
+        check(n, d);
+    }
+}
+
+TEST(Divider, edges){
+    const uint256_t divisors[] = {
+        1, 2, 3, 7, 10, uint64_t(-1), uint256_1 << 64, (uint256_1 << 64) + 1,
+        (uint256_1 << 128) - 1, (uint256_1 << 255) - 1, (uint256_1 << 255) + 1, uint256_max - 1, uint256_max,
+    };
+    const uint256_t dividends[] = {
+        0, 1, 2, 9, uint64_t(-1), uint256_1 << 64, (uint256_1 << 128) - 1, uint256_1 << 255, uint256_max - 1, uint256_max,
+    };
+    for (const uint256_t & d : divisors) {
+        for (const uint256_t & n : dividends) {
+            check(n, d);
+        }
+        check(d, d);
+        check(d - 1, d);
+        check(d + 1, d);
+    }
+    EXPECT_THROW(uint256_divider{ uint256_0 }, std::domain_error);
+}
+
+TEST(Divider, compound){
+    const uint256_divider d(1000);
+    uint256_t x = 123456789;
+    x /= d;
+    EXPECT_EQ(x, 123456);
+    x %= d;
+    EXPECT_EQ(x, 456);
+    EXPECT_EQ(d.divisor(), 1000);
+}
+
+TEST(Divider, pow10){
+    static_assert(uint256::pow10<0>() == 1);
+    static_assert(uint256::pow10<19>() == 10000000000000000000ULL);
+    static_assert(uint256_t(5000000000000000000ULL) / uint256::pow10_divider<18> == 5);
+    static_assert(uint256_max / uint256::pow10_divider<77> == 1);
+    static_assert(uint256_max % uint256::pow10_divider<2> == 35);
+
+    std::mt19937_64 gen(19);
+    for (int i = 0; i < 200; i++) {
+        const uint256_t n(gen(), gen(), gen(), gen());
+        EXPECT_EQ(n / uint256::pow10_divider<18>, n / uint256::pow10<18>());
+        EXPECT_EQ(n % uint256::pow10_divider<30>, n % uint256::pow10<30>());
+        EXPECT_EQ(n / uint256::pow10_divider<60>, n / uint256::pow10<60>());
+    }
+}
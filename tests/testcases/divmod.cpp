@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+TEST(Arithmetic, divmod){
+    const uint256_t val(0xfedcba9876543210ULL, 0x0123456789abcdefULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL);
+    const uint256_t div(0x0000000000000000ULL, 0x1122334455667788ULL, 0x99aabbccddeeff00ULL, 0xffeeddccbbaa9988ULL);
+
+    const std::pair <uint256_t, uint256_t> qr = uint256_t::divmod(val, div);
+    EXPECT_EQ(qr.first,  val / div);
+    EXPECT_EQ(qr.second, val % div);
+    EXPECT_EQ(qr.first * div + qr.second, val);
+
+    EXPECT_THROW(uint256_t::divmod(val, uint256_t(0)), std::domain_error);
+}
+
+TEST(Arithmetic, divmod_uint128){
+    const uint256_t val(0xfedcba9876543210ULL, 0x0123456789abcdefULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL);
+    const uint128_t div(0xfffffffffffffffeULL, 0xffffffffffffffffULL);
+
+    const std::pair <uint256_t, uint128_t> qr = uint256_t::divmod(val, div);
+    EXPECT_EQ(qr.first,  uint256_t(0x0000000000000000ULL, 0x0000000000000000ULL, 0xfedcba9876543211ULL, 0x0000000000000001ULL));
+    EXPECT_EQ(qr.second, uint128_t(0x0dfae7d4c1ae9b8aULL, 0x8796a5b4c3d2e1f1ULL));
+
+    // upper half of the divisor is zero
+    const std::pair <uint256_t, uint128_t> small = uint256_t::divmod(val, uint128_t(0x89abcdefULL));
+    EXPECT_EQ(small.first,  uint256_t(0x00000001d9ead7d0ULL, 0xe90ac0e3efe4c1c5ULL, 0xfd8a449528234ef6ULL, 0x4a14877a45a03981ULL));
+    EXPECT_EQ(small.second, uint128_t(0x000000000305e581ULL));
+
+    EXPECT_THROW(uint256_t::divmod(val, uint128_0), std::domain_error);
+}
+
+TEST(Arithmetic, divmod_uint64){
+    const uint256_t val(0xfedcba9876543210ULL, 0x0123456789abcdefULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL);
+
+    const std::pair <uint256_t, uint64_t> qr = uint256_t::divmod(val, (uint64_t) 0x89abcdefULL);
+    EXPECT_EQ(qr.first,  uint256_t(0x00000001d9ead7d0ULL, 0xe90ac0e3efe4c1c5ULL, 0xfd8a449528234ef6ULL, 0x4a14877a45a03981ULL));
+    EXPECT_EQ(qr.second, 0x000000000305e581ULL);
+
+    const std::pair <uint256_t, uint64_t> zero = uint256_t::divmod(uint256_t(0), (uint64_t) 10);
+    EXPECT_EQ(zero.first,  0);
+    EXPECT_EQ(zero.second, 0ULL);
+
+    EXPECT_THROW(uint256_t::divmod(val, (uint64_t) 0), std::domain_error);
+}
+
+TEST(Arithmetic, divmod_narrow){
+    // dividends below 2^64 and 2^128 are divided natively
+    const uint256_t n64(0xfedcba9876543210ULL);
+    const uint256_t n128(0x0000000000000000ULL, 0x0000000000000000ULL, 0xfedcba9876543210ULL, 0x0123456789abcdefULL);
+    const uint256_t divisors[] = { 1, 3, 0x89abcdefULL, 0xfedcba9876543210ULL, n128 >> 7, n128 };
+
+    for (const uint256_t & d : divisors) {
+        for (const uint256_t & n : { n64, n128 }) {
+            const std::pair <uint256_t, uint256_t> qr = uint256_t::divmod(n, d);
+            EXPECT_EQ(qr.first * d + qr.second, n);
+            EXPECT_LT(qr.second, d);
+        }
+    }
+
+    EXPECT_EQ(uint256_t::divmod(n64, uint256_t(0x10000ULL)).first, 0xfedcba987654ULL);
+    EXPECT_EQ(uint256_t::divmod(n128, uint256_t(0xfedcba9876543210ULL)).first, uint256_1 << 64);
+    EXPECT_EQ(uint256_t::divmod(n128, uint256_t(0xfedcba9876543210ULL)).second, 0x0123456789abcdefULL);
+
+    const std::pair <uint256_t, uint64_t> qr = uint256_t::divmod(n64, (uint64_t) 10);
+    EXPECT_EQ(qr.first, 0x197c790f3f086b68ULL);
+    EXPECT_EQ(qr.second, 0ULL);
+}
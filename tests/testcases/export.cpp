@@ -0,0 +1,102 @@
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "uint256_export.h"
+
+namespace {
+
+std::vector<uint256_t> values(const std::size_t n) {
+    std::mt19937_64 gen(23);
+    std::vector<uint256_t> out;
+    for (std::size_t i = 0; i < n; i++) {
+        const uint256_t x(gen(), gen(), gen(), gen());
+        out.push_back(x >> (unsigned int)(gen() % 256));
+    }
+    out.push_back(0);
+    out.push_back(uint256_max);
+    return out;
+}
+
+std::string expected(const std::vector<uint256_t> & in, const uint8_t base, const std::string & separator) {
+    std::string out;
+    for (const uint256_t & x : in) {
+        out += x.str(base) + separator;
+    }
+    return out;
+}
+
+}
+
+TEST(Export, matches_str){
+    const std::vector<uint256_t> in = values(1000);
+    for (const unsigned int threads : { 1, 2, 5 }) {
+        for (const std::size_t chunk : { 1, 7, 1000, 5000 }) {
+            std::string out;
+            std::size_t calls = 0;
+            const std::size_t written = uint256::to_chars_batch(in, [&](std::string_view s) {
+                out += s;
+                calls++;
+            }, { .chunk_values = chunk, .threads = threads });
+            EXPECT_EQ(out, expected(in, 10, "\n"));
+            EXPECT_EQ(written, out.size());
+            EXPECT_EQ(calls, (in.size() + chunk - 1) / chunk);
+        }
+    }
+}
+
+TEST(Export, base_and_separator){
+    const std::vector<uint256_t> in = values(300);
+    for (const int base : { 2, 16, 36 }) {
+        std::string out;
+        uint256::to_chars_batch(in, [&](std::string_view s) {
+            out += s;
+        }, { .base = base, .separator = ",", .chunk_values = 64, .threads = 3 });
+        EXPECT_EQ(out, expected(in, base, ","));
+    }
+
+    std::string out;
+    uint256::to_chars_batch(in, [&](std::string_view s) {
+        out += s;
+    }, { .separator = "" , .chunk_values = 64 });
+    EXPECT_EQ(out, expected(in, 10, ""));
+
+    EXPECT_EQ(uint256::to_chars_batch({}, [](std::string_view) {
+        FAIL();
+    }), 0);
+
+    EXPECT_THROW(uint256::to_chars_batch(in, [](std::string_view) {}, { .base = 1 }), std::invalid_argument);
+    EXPECT_THROW(uint256::to_chars_batch(in, [](std::string_view) {}, { .chunk_values = 0 }), std::invalid_argument);
+}
+
+TEST(Export, sink_errors){
+    const std::vector<uint256_t> in = values(1000);
+    for (const unsigned int threads : { 1, 4 }) {
+        std::size_t calls = 0;
+        EXPECT_THROW(uint256::to_chars_batch(in, [&](std::string_view) {
+            if (++calls == 3) {
+                throw std::runtime_error("disk full");
+            }
+        }, { .chunk_values = 10, .threads = threads }), std::runtime_error);
+        EXPECT_EQ(calls, 3);
+    }
+}
+
+TEST(Export, fd_sink){
+    const std::vector<uint256_t> in = values(2000);
+    std::FILE * file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    const std::size_t written = uint256::to_chars_batch(in, uint256::fd_sink(fileno(file)), { .chunk_values = 100, .threads = 3 });
+
+    std::string out(written, '\0');
+    std::rewind(file);
+    EXPECT_EQ(std::fread(out.data(), 1, out.size(), file), written);
+    std::fclose(file);
+    EXPECT_EQ(out, expected(in, 10, "\n"));
+
+    EXPECT_THROW(uint256::fd_sink(-1)("x"), std::system_error);
+}
@@ -0,0 +1,136 @@
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#if defined(UINT256_TEST_FMT)
+#   include <fmt/format.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include "uint256_format.h"
+
+namespace {
+
+// what both formatters do for "{:<spec>}"
+std::string format(const std::string_view spec, const uint256_t & value) {
+    uint256::detail::format_spec parsed;
+    const char * const end = uint256::detail::parse_format_spec(spec.data(), spec.data() + spec.size(), parsed, [](const char * message) {
+        throw std::invalid_argument(message);
+    });
+    EXPECT_EQ(end, spec.data() + spec.size());
+    std::string out;
+    uint256::detail::write_formatted(std::back_inserter(out), value, parsed);
+    return out;
+}
+
+const uint256_t big(0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL);
+
+}
+
+TEST(Format, types){
+    EXPECT_EQ(format("", big), big.str(10));
+    EXPECT_EQ(format("d", big), big.str(10));
+    EXPECT_EQ(format("x", big), big.str(16));
+    EXPECT_EQ(format("X", uint256_t(0xabcdef0123ULL)), "ABCDEF0123");
+    EXPECT_EQ(format("b", uint256_t(10)), "1010");
+    EXPECT_EQ(format("o", uint256_t(8)), "10");
+    EXPECT_EQ(format("", uint256_0), "0");
+    EXPECT_EQ(format("", uint256_max), "115792089237316195423570985008687907853269984665640564039457584007913129639935");
+    EXPECT_EQ(format("b", uint256_max), std::string(256, '1'));
+}
+
+TEST(Format, prefix_and_zero_padding){
+    EXPECT_EQ(format("#x", uint256_t(255)), "0xff");
+    EXPECT_EQ(format("#X", uint256_t(255)), "0XFF");
+    EXPECT_EQ(format("#b", uint256_t(5)), "0b101");
+    EXPECT_EQ(format("#B", uint256_t(5)), "0B101");
+    EXPECT_EQ(format("#o", uint256_t(8)), "010");
+    EXPECT_EQ(format("#o", uint256_0), "0");
+    EXPECT_EQ(format("#d", uint256_t(7)), "7");
+
+    // the usual way to print a hash: prefix and all 64 digits
+    EXPECT_EQ(format("#066x", uint256_t(0x1f)), "0x" + std::string(62, '0') + "1f");
+    EXPECT_EQ(format("#066x", uint256_max), "0x" + std::string(64, 'f'));
+    EXPECT_EQ(format("08", uint256_t(42)), "00000042");
+    EXPECT_EQ(format("+08", uint256_t(42)), "+0000042");
+
+    // an explicit alignment turns zero padding off
+    EXPECT_EQ(format("<08", uint256_t(42)), "42      ");
+}
+
+TEST(Format, width_and_fill){
+    EXPECT_EQ(format("6", uint256_t(42)), "    42");
+    EXPECT_EQ(format("<6", uint256_t(42)), "42    ");
+    EXPECT_EQ(format("^6", uint256_t(42)), "  42  ");
+    EXPECT_EQ(format("^7", uint256_t(42)), "  42   ");
+    EXPECT_EQ(format("*>6", uint256_t(42)), "****42");
+    EXPECT_EQ(format("\xc2\xb7<4", uint256_t(42)), "42\xc2\xb7\xc2\xb7");
+    EXPECT_EQ(format(">1", uint256_t(12345)), "12345");
+    EXPECT_EQ(format(" ", uint256_t(1)), " 1");
+    EXPECT_EQ(format("+", uint256_t(1)), "+1");
+    EXPECT_EQ(format("-", uint256_t(1)), "1");
+}
+
+TEST(Format, grouping){
+    EXPECT_EQ(format(",", uint256_t(1)), "1");
+    EXPECT_EQ(format(",", uint256_t(999)), "999");
+    EXPECT_EQ(format(",", uint256_t(1000)), "1,000");
+    EXPECT_EQ(format(",", uint256_t(1000000000000000000ULL)), "1,000,000,000,000,000,000");
+    EXPECT_EQ(format("_", uint256_t(1234567)), "1_234_567");
+    EXPECT_EQ(format("_x", uint256_t(0xdeadbeefULL)), "dead_beef");
+    EXPECT_EQ(format("#_b", uint256_t(0x1ffULL)), "0b1_1111_1111");
+    EXPECT_EQ(format(">12,", uint256_t(1234567)), "   1,234,567");
+
+    const std::string all = format(",", uint256_max);
+    EXPECT_EQ(all.size(), 78u + 25u);
+    EXPECT_EQ(all.substr(0, 8), "115,792,");
+    EXPECT_EQ(format("_b", uint256_max).size(), 256u + 63u);
+}
+
+TEST(Format, errors){
+    EXPECT_THROW(format("q", big), std::invalid_argument);
+    EXPECT_THROW(format(".3", big), std::invalid_argument);
+    EXPECT_THROW(format("L", big), std::invalid_argument);
+    EXPECT_THROW(format("{}", big), std::invalid_argument);
+    EXPECT_THROW(format("xx", big), std::invalid_argument);
+    EXPECT_THROW(format("99999999", big), std::invalid_argument);
+}
+
+TEST(Format, ostream){
+    std::ostringstream s;
+    s << big << ' ' << std::hex << uint256_t(255) << ' ' << std::oct << uint256_t(8);
+    EXPECT_EQ(s.str(), big.str(10) + " ff 10");
+
+    std::ostringstream padded;
+    padded << std::setw(6) << std::setfill('.') << uint256_t(42);
+    EXPECT_EQ(padded.str(), "....42");
+}
+
+#if defined(__cpp_lib_format)
+TEST(Format, std_format){
+    EXPECT_EQ(std::format("{}", big), big.str(10));
+    EXPECT_EQ(std::format("{:#066x}", uint256_t(0x1f)), "0x" + std::string(62, '0') + "1f");
+    EXPECT_EQ(std::format("[{:>12,}]", uint256_t(1234567)), "[   1,234,567]");
+    EXPECT_EQ(std::format("{0:b} {0:o}", uint256_t(8)), "1000 10");
+    EXPECT_THROW((void)std::vformat("{:.3}", std::make_format_args(big)), std::format_error);
+}
+#endif
+
+#if defined(UINT256_TEST_FMT)
+TEST(Format, fmt_format){
+    EXPECT_EQ(fmt::format("{}", big), big.str(10));
+    EXPECT_EQ(fmt::format("{:#066x}", uint256_t(0x1f)), "0x" + std::string(62, '0') + "1f");
+    EXPECT_EQ(fmt::format("[{:>12,}]", uint256_t(1234567)), "[   1,234,567]");
+    EXPECT_EQ(fmt::format("{0:b} {0:o}", uint256_t(8)), "1000 10");
+
+    fmt::memory_buffer out;
+    fmt::format_to(std::back_inserter(out), "{:_x}", uint256_t(0xdeadbeefULL));
+    EXPECT_EQ(fmt::to_string(out), "dead_beef");
+
+    EXPECT_THROW((void)fmt::format(fmt::runtime("{:.3}"), big), fmt::format_error);
+}
+#endif
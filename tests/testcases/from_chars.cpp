@@ -0,0 +1,113 @@
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+static std::from_chars_result parse(const std::string & s, uint256_t & value, const int base = 10) {
+    return from_chars(s.data(), s.data() + s.size(), value, base);
+}
+
+TEST(FromChars, round_trip){
+    std::mt19937_64 gen(7);
+    for (int i = 0; i < 200; i++) {
+        uint256_t value(gen(), gen(), gen(), gen());
+        value >>= (unsigned int)(gen() % 256);
+        for (int base = 2; base <= 36; base++) {
+            const std::string s = value.str(base);
+            uint256_t parsed = 0;
+            const std::from_chars_result res = parse(s, parsed, base);
+            ASSERT_EQ(res.ec, std::errc{});
+            EXPECT_EQ(res.ptr, s.data() + s.size());
+            EXPECT_EQ(parsed, value) << "base " << base << ": " << s;
+        }
+    }
+}
+
+TEST(FromChars, stops_at_first_non_digit){
+    uint256_t value = 0;
+    const std::string dec = "1234567890123456789012345678,9";
+    std::from_chars_result res = parse(dec, value);
+    EXPECT_EQ(res.ec, std::errc{});
+    EXPECT_EQ(res.ptr, dec.data() + 28);
+    EXPECT_EQ(value.str(), "1234567890123456789012345678");
+
+    // the eight digit fast path must not swallow a non-digit
+    const std::string swar = "1234567x";
+    res = parse(swar, value);
+    EXPECT_EQ(res.ptr, swar.data() + 7);
+    EXPECT_EQ(value, 1234567);
+
+    // digits are validated against the base
+    const std::string oct = "7789";
+    res = parse(oct, value, 8);
+    EXPECT_EQ(res.ptr, oct.data() + 2);
+    EXPECT_EQ(value, 077);
+
+    const std::string hex = "DeadBeef";
+    res = parse(hex, value, 16);
+    EXPECT_EQ(res.ec, std::errc{});
+    EXPECT_EQ(value, 0xdeadbeefULL);
+
+    const std::string zeros = std::string(100, '0') + "42";
+    res = parse(zeros, value);
+    EXPECT_EQ(res.ec, std::errc{});
+    EXPECT_EQ(value, 42);
+}
+
+TEST(FromChars, errors){
+    uint256_t value = 5;
+    const std::string empty = "";
+    std::from_chars_result res = parse(empty, value);
+    EXPECT_EQ(res.ec, std::errc::invalid_argument);
+    EXPECT_EQ(res.ptr, empty.data());
+
+    const std::string sign = "-1";
+    res = parse(sign, value);
+    EXPECT_EQ(res.ec, std::errc::invalid_argument);
+    EXPECT_EQ(res.ptr, sign.data());
+
+    const std::string prefix = "0x10";
+    res = parse(prefix, value, 16);
+    EXPECT_EQ(res.ec, std::errc{});
+    EXPECT_EQ(res.ptr, prefix.data() + 1);
+    value = 5;
+
+    res = parse("1", value, 37);
+    EXPECT_EQ(res.ec, std::errc::invalid_argument);
+
+    // max + 1: every digit is consumed and value is left untouched
+    const std::string dec = "115792089237316195423570985008687907853269984665640564039457584007913129639936";
+    res = parse(dec, value);
+    EXPECT_EQ(res.ec, std::errc::result_out_of_range);
+    EXPECT_EQ(res.ptr, dec.data() + dec.size());
+    EXPECT_EQ(value, 5);
+
+    const std::string hex = "1" + std::string(64, '0');
+    res = parse(hex, value, 16);
+    EXPECT_EQ(res.ec, std::errc::result_out_of_range);
+    EXPECT_EQ(value, 5);
+
+    res = parse(std::string(64, 'f'), value, 16);
+    EXPECT_EQ(res.ec, std::errc{});
+    EXPECT_EQ(value, uint256_max);
+}
+
+TEST(FromChars, constructor){
+    EXPECT_THROW(uint256_t("12z", 10), std::invalid_argument);
+    EXPECT_THROW(uint256_t("19", 8), std::invalid_argument);
+    EXPECT_THROW(uint256_t("1", 1), std::invalid_argument);
+    EXPECT_THROW(uint256_t("1" + std::string(64, '0'), 16), std::out_of_range);
+    EXPECT_EQ(uint256_t("", 10), 0);
+}
+
+TEST(FromChars, compile_time){
+    constexpr auto parse_dec = [](const char * s, const std::size_t n) {
+        uint256_t value = 0;
+        from_chars(s, s + n, value, 10);
+        return value;
+    };
+    static_assert(parse_dec("18446744073709551616", 20) == (uint256_1 << 64));
+    static_assert(uint256_t("ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff", 16) == uint256_max);
+}
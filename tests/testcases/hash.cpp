@@ -0,0 +1,54 @@
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+TEST(Hash, consistent){
+    const uint256_t a(1, 2, 3, 4);
+    EXPECT_EQ(std::hash<uint256_t>{}(a), std::hash<uint256_t>{}(uint256_t(1, 2, 3, 4)));
+    EXPECT_EQ(std::hash<uint256_t>{}(a), hash_value(a));
+    static_assert(hash_value(uint256_max) == std::hash<uint256_t>{}(uint256_max));
+    static_assert(noexcept(std::hash<uint256_t>{}(uint256_0)));
+}
+
+TEST(Hash, distinct){
+    // single bit flips in any limb and swapped limbs all land elsewhere
+    std::unordered_set<std::size_t> seen;
+    seen.insert(hash_value(uint256_0));
+    for (unsigned int i = 0; i < 256; i++) {
+        EXPECT_TRUE(seen.insert(hash_value(uint256_1 << i)).second) << i;
+    }
+    EXPECT_NE(hash_value(uint256_t(1, 2, 3, 4)), hash_value(uint256_t(4, 3, 2, 1)));
+    EXPECT_NE(hash_value(uint256_t(1, 2, 3, 4)), hash_value(uint256_t(3, 4, 1, 2)));
+}
+
+TEST(Hash, low_bits){
+    // sequential keys should spread over the low bits used by bucket masks
+    const std::size_t buckets = 1024;
+    std::vector<int> counts(buckets);
+    for (uint64_t i = 0; i < 64 * buckets; i++) {
+        counts[hash_value(uint256_t(i) << 64) & (buckets - 1)]++;
+    }
+    for (const int c : counts) {
+        EXPECT_GT(c, 24);
+        EXPECT_LT(c, 104);
+    }
+}
+
+TEST(Hash, unordered_map){
+    std::mt19937_64 gen(20);
+    std::unordered_map<uint256_t, int> m;
+    std::vector<uint256_t> keys;
+    for (int i = 0; i < 1000; i++) {
+        keys.emplace_back(gen(), gen(), gen(), gen());
+        m[keys.back()] = i;
+    }
+    ASSERT_EQ(m.size(), keys.size());
+    for (int i = 0; i < 1000; i++) {
+        EXPECT_EQ(m.at(keys[i]), i);
+    }
+    EXPECT_EQ(m.count(uint256_0), 0);
+}
@@ -0,0 +1,117 @@
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "uint256_instrument.h"
+#include "uint256_t.h"
+
+using uint256::instrument::operation;
+
+namespace {
+
+const uint256_t narrow(0x0123456789abcdefULL);
+const uint256_t wide(0x00000000000000ffULL, 0xfedcba9876543210ULL, 0x0123456789abcdefULL, 0x0f1e2d3c4b5a6978ULL);
+
+}
+
+// probes do nothing during constant evaluation, so this compiles in both builds
+static_assert(uint256_t(3) * uint256_t(5) == 15);
+static_assert(uint256_t::divmod(uint256_t(17), uint256_t(5)).second == 2);
+
+TEST(Instrument, dump_format){
+    uint256::instrument::stats s;
+    s.operations[(std::size_t)operation::multiply].calls = 3;
+    s.operations[(std::size_t)operation::multiply].lhs_bits[2] = 3;
+    s.operations[(std::size_t)operation::multiply].rhs_bits[0] = 1;
+
+    std::ostringstream out;
+    uint256::instrument::dump(out, s);
+    const std::string text = out.str();
+    EXPECT_NE(text.find("# TYPE uint256_operations_total counter\n"), std::string::npos);
+    EXPECT_NE(text.find("uint256_operations_total{op=\"multiply\"} 3\n"), std::string::npos);
+    EXPECT_NE(text.find("uint256_operations_total{op=\"divmod\"} 0\n"), std::string::npos);
+    EXPECT_NE(text.find("uint256_operand_bits_total{op=\"multiply\",operand=\"lhs\",bits=\"33-64\"} 3\n"), std::string::npos);
+    EXPECT_NE(text.find("uint256_operand_bits_total{op=\"multiply\",operand=\"rhs\",bits=\"0\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("uint256_sampled_cycles_total{op=\"str\"} 0\n"), std::string::npos);
+}
+
+#if defined(UINT256_INSTRUMENT)
+namespace {
+
+uint64_t calls(const uint256::instrument::stats & before, const uint256::instrument::stats & after, const operation op) {
+    return after[op].calls - before[op].calls;
+}
+
+}
+
+TEST(Instrument, counts_operations){
+    const uint256::instrument::stats before = uint256::instrument::snapshot();
+    EXPECT_EQ(narrow * wide, wide * narrow);
+    EXPECT_EQ(uint256_t::divmod(wide, narrow).first, wide / narrow);
+    EXPECT_EQ(uint256_t(narrow.str(), 10), narrow);
+    EXPECT_EQ(narrow.export_bits().size(), 32u);
+    EXPECT_EQ(narrow.export_bits_truncate().size(), 8u);
+    const uint256::instrument::stats after = uint256::instrument::snapshot();
+
+    EXPECT_EQ(calls(before, after, operation::multiply), 2u);
+    EXPECT_EQ(calls(before, after, operation::divmod), 2u);
+    EXPECT_EQ(calls(before, after, operation::str), 1u);
+    EXPECT_EQ(calls(before, after, operation::init_from_base), 1u);
+    EXPECT_EQ(calls(before, after, operation::export_bits), 2u);
+
+    // 57 and 200 bits
+    EXPECT_EQ(after[operation::multiply].lhs_bits[2] - before[operation::multiply].lhs_bits[2], 1u);
+    EXPECT_EQ(after[operation::multiply].lhs_bits[7] - before[operation::multiply].lhs_bits[7], 1u);
+    EXPECT_EQ(after[operation::multiply].rhs_bits[7] - before[operation::multiply].rhs_bits[7], 1u);
+    EXPECT_EQ(after[operation::init_from_base].lhs_bits[2] - before[operation::init_from_base].lhs_bits[2], 1u);
+}
+
+TEST(Instrument, nested_calls_count_once){
+    const uint256::instrument::stats before = uint256::instrument::snapshot();
+    // forwards to the uint64_t overload
+    EXPECT_EQ(uint256_t::divmod(wide, uint128_t(10)).second, uint128_t(uint256_t::divmod(wide, (uint64_t)10).second));
+    const uint256::instrument::stats after = uint256::instrument::snapshot();
+    EXPECT_EQ(calls(before, after, operation::divmod), 2u);
+
+    // a throwing call is still counted and does not leave the probe active
+    EXPECT_THROW(uint256_t::divmod(wide, uint256_0), std::domain_error);
+    EXPECT_EQ(calls(after, uint256::instrument::snapshot(), operation::divmod), 1u);
+}
+
+TEST(Instrument, threads_and_sampling){
+    const uint32_t period = uint256::instrument::sample_period();
+    uint256::instrument::set_sample_period(1);
+    const uint256::instrument::stats before = uint256::instrument::snapshot();
+    std::thread worker([] {
+        uint256_t x = narrow;
+        for (int i = 0; i < 100; i++) {
+            x = x * narrow;
+        }
+        EXPECT_TRUE(x);
+    });
+    worker.join();
+    const uint256::instrument::stats after = uint256::instrument::snapshot();
+    uint256::instrument::set_sample_period(period);
+
+    // the worker has exited; its counts moved to the retired totals
+    EXPECT_EQ(calls(before, after, operation::multiply), 100u);
+    EXPECT_EQ(after[operation::multiply].sampled - before[operation::multiply].sampled, 100u);
+    EXPECT_GT(after[operation::multiply].cycles, before[operation::multiply].cycles);
+}
+
+TEST(Instrument, reset){
+    EXPECT_EQ(narrow * narrow, narrow * narrow);
+    uint256::instrument::reset();
+    EXPECT_EQ(uint256::instrument::snapshot()[operation::multiply].calls, 0u);
+    EXPECT_EQ(narrow.str(16), "123456789abcdef");
+    EXPECT_EQ(uint256::instrument::snapshot()[operation::str].calls, 1u);
+}
+#else
+TEST(Instrument, disabled){
+    EXPECT_FALSE(uint256::instrument::enabled);
+    EXPECT_EQ(narrow * wide, wide * narrow);
+    EXPECT_EQ(uint256::instrument::snapshot()[operation::multiply].calls, 0u);
+}
+#endif
@@ -0,0 +1,106 @@
+#include <random>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+static_assert(isqrt(uint256_t(144)) == 12);
+static_assert(ipow(uint256_t(10), 18).first == 1000000000000000000ULL);
+static_assert(log10(uint256_max) == 77);
+
+TEST(IntMath, isqrt){
+    EXPECT_EQ(isqrt(uint256_0), 0);
+    EXPECT_EQ(isqrt(uint256_1), 1);
+    EXPECT_EQ(isqrt(uint256_t(3)), 1);
+    EXPECT_EQ(isqrt(uint256_t(4)), 2);
+    EXPECT_EQ(isqrt(uint256_t(0xffffffffffffffffULL)), 0xffffffffULL);
+    EXPECT_EQ(isqrt(uint256_1 << 64), uint256_1 << 32);
+    EXPECT_EQ(isqrt(uint256_max), uint256_t(0, 0, 0xffffffffffffffffULL, 0xffffffffffffffffULL));
+    EXPECT_EQ(isqrt(uint256_1 << 255), 0xb504f333f9de6484597d89b3754abe9f_u256);
+
+    // squares and their neighbours across the whole range
+    std::mt19937_64 gen(29);
+    for (int i = 0; i < 2000; i++) {
+        const uint256_t r = uint256_t(0, 0, gen(), gen()) >> (unsigned int)(gen() % 128);
+        const uint256_t sq = r * r;
+        EXPECT_EQ(isqrt(sq), r);
+        if (sq) {
+            EXPECT_EQ(isqrt(sq - 1), r - 1);
+        }
+        EXPECT_EQ(isqrt(sq + r + r), r);
+
+        const uint256_t x(gen(), gen(), gen(), gen());
+        const uint256_t y = x >> (unsigned int)(gen() % 256);
+        const uint256_t s = isqrt(y);
+        EXPECT_LE(s * s, y);
+        EXPECT_GT((s + 1) * (s + 1), y);
+    }
+}
+
+TEST(IntMath, ipow){
+    EXPECT_EQ(ipow(uint256_t(7), 0), std::make_pair(uint256_1, false));
+    EXPECT_EQ(ipow(uint256_0, 0), std::make_pair(uint256_1, false));
+    EXPECT_EQ(ipow(uint256_0, 1000), std::make_pair(uint256_0, false));
+    EXPECT_EQ(ipow(uint256_1, ~0ULL), std::make_pair(uint256_1, false));
+    EXPECT_EQ(ipow(uint256_t(3), 5), std::make_pair(uint256_t(243), false));
+    EXPECT_EQ(ipow(uint256_t(10), 77).first, uint256_t("100000000000000000000000000000000000000000000000000000000000000000000000000000", 10));
+    EXPECT_FALSE(ipow(uint256_t(10), 77).second);
+    EXPECT_TRUE(ipow(uint256_t(10), 78).second);
+
+    // powers of two land exactly on the boundary
+    EXPECT_EQ(ipow(uint256_t(2), 255), std::make_pair(uint256_1 << 255, false));
+    EXPECT_EQ(ipow(uint256_t(2), 256), std::make_pair(uint256_0, true));
+    EXPECT_EQ(ipow(uint256_1 << 128, 2), std::make_pair(uint256_0, true));
+    EXPECT_EQ(ipow(uint256_max, 1), std::make_pair(uint256_max, false));
+    EXPECT_EQ(ipow(uint256_max, 2), std::make_pair(uint256_1, true));
+
+    // large bases whose square would overflow
+    EXPECT_EQ(ipow(uint256_1 << 200, 1), std::make_pair(uint256_1 << 200, false));
+    EXPECT_EQ(ipow(uint256_t(1ULL << 40), 6), std::make_pair(uint256_1 << 240, false));
+
+    // the wrapped value matches repeated wrapping multiplication
+    const uint256_t b(0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f1ULL);
+    uint256_t expected = uint256_1;
+    for (uint64_t e = 0; e < 40; e++) {
+        EXPECT_EQ(ipow(b, e).first, expected);
+        EXPECT_EQ(ipow(b, e).second, e > 1);
+        expected *= b;
+    }
+}
+
+TEST(IntMath, log2){
+    EXPECT_EQ(log2(uint256_1), 0);
+    EXPECT_EQ(log2(uint256_t(2)), 1);
+    EXPECT_EQ(log2(uint256_t(3)), 1);
+    EXPECT_EQ(log2(uint256_max), 255);
+    for (unsigned int i = 0; i < 256; i++) {
+        EXPECT_EQ(log2(uint256_1 << i), (int)i);
+        EXPECT_EQ(log2(((uint256_1 << i) - 1) | (uint256_1 << i)), (int)i);
+    }
+    EXPECT_THROW(log2(uint256_0), std::domain_error);
+}
+
+TEST(IntMath, log10){
+    EXPECT_EQ(log10(uint256_1), 0);
+    EXPECT_EQ(log10(uint256_t(9)), 0);
+    EXPECT_EQ(log10(uint256_t(10)), 1);
+    EXPECT_EQ(log10(uint256_max), 77);
+
+    uint256_t p = uint256_1;
+    for (int i = 0; i < 78; i++) {
+        EXPECT_EQ(log10(p), i);
+        if (p > 1) {
+            EXPECT_EQ(log10(p - 1), i - 1);
+        }
+        EXPECT_EQ(log10(p + 1), i);
+        p *= 10;
+    }
+    // every width where bits * log10(2) could round either way
+    for (unsigned int i = 0; i < 256; i++) {
+        const uint256_t x = uint256_1 << i;
+        EXPECT_EQ(log10(x), (int)x.str().size() - 1);
+        EXPECT_EQ(log10(x | (x - 1)), (int)(x | (x - 1)).str().size() - 1);
+    }
+    EXPECT_THROW(log10(uint256_0), std::domain_error);
+}
@@ -25,6 +25,40 @@ TEST(BitShift, left){
     }
 }
 
+TEST(BitShift, left_across_limbs){
+    const uint256_t val(0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL);
+
+    EXPECT_EQ(val << 0,   val);
+    EXPECT_EQ(val << 4,   uint256_t(0x123456789abcdeffULL, 0xedcba98765432100ULL, 0xf1e2d3c4b5a69788ULL, 0x796a5b4c3d2e1f00ULL));
+    EXPECT_EQ(val << 64,  uint256_t(0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL, 0x0000000000000000ULL));
+    EXPECT_EQ(val << 68,  uint256_t(0xedcba98765432100ULL, 0xf1e2d3c4b5a69788ULL, 0x796a5b4c3d2e1f00ULL, 0x0000000000000000ULL));
+    EXPECT_EQ(val << 128, uint256_t(0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL));
+    EXPECT_EQ(val << 196, uint256_t(0x796a5b4c3d2e1f00ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL));
+    EXPECT_EQ(val << 255, uint256_t(0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL));
+    EXPECT_EQ(uint256_max << 255, uint256_t(0x8000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL));
+
+    // out of range counts clear the value
+    EXPECT_EQ(val << 256,            0);
+    EXPECT_EQ(val << 0x100000000ULL, 0);
+    EXPECT_EQ(val << -1,             0);
+    EXPECT_EQ(val << uint256_max,    0);
+
+    for(unsigned int i = 0; i < 256; i++){
+        EXPECT_EQ(val << i, val * (uint256_1 << uint256_t(i)));
+    }
+}
+
+TEST(BitShift, left_compile_time){
+    const uint256_t val(0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL);
+
+    EXPECT_EQ(val.shl<0>(),   val);
+    EXPECT_EQ(val.shl<1>(),   val << 1);
+    EXPECT_EQ(val.shl<64>(),  val << 64);
+    EXPECT_EQ(val.shl<68>(),  val << 68);
+    EXPECT_EQ(val.shl<128>(), val << 128);
+    EXPECT_EQ(val.shl<255>(), val << 255);
+}
+
 TEST(External, shift_left){
     bool      t    = true;
     bool      f    = false;
@@ -0,0 +1,29 @@
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+TEST(Literal, decimal){
+    static_assert(0_u256 == uint256_0);
+    static_assert(1_u256 == uint256_1);
+    static_assert(1000000000000000000_u256 == uint256_t(1000000000000000000ULL));
+    static_assert(115792089237316195423570985008687907853269984665640564039457584007913129639935_u256 == uint256_max);
+    static_assert(1'000'000'000'000'000'000'000_u256 == uint256_t(1000000000000000000ULL) * 1000);
+    EXPECT_EQ(340282366920938463463374607431768211456_u256, uint256_1 << 128);
+}
+
+TEST(Literal, prefixed){
+    static_assert(0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff_u256 == uint256_max);
+    static_assert(0XDEAD'BEEF_u256 == uint256_t(0xdeadbeefULL));
+    static_assert(0x1000000000000000000000000000000000000000000000000_u256 == (uint256_1 << 192));
+    static_assert(0b1010_u256 == uint256_t(10));
+    static_assert(0755_u256 == uint256_t(0755));
+    EXPECT_EQ((0xfffffffffffffffffffffffffffffffeffffffffffffffffffffffffffffff_u256).str(16), "fffffffffffffffffffffffffffffffeffffffffffffffffffffffffffffff");
+}
+
+TEST(Literal, constant_initialization){
+    // usable in constant expressions, so no dynamic initialization is involved
+    static constexpr uint256_t modulus = 0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_u256;
+    static_assert(modulus.upper().upper() == 0xffffffffffffffffULL);
+    static_assert(modulus.lower().lower() == 0xfffffffefffffc2fULL);
+    EXPECT_EQ(modulus % 2, 1);
+}
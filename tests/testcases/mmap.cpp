@@ -0,0 +1,184 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "uint256_mmap.h"
+
+namespace {
+
+std::string temp_path(const std::string & name) {
+    return (std::filesystem::temp_directory_path() / ("uint256_mmap_" + name)).string();
+}
+
+std::vector<uint256_t> values(const std::size_t n) {
+    std::mt19937_64 gen(24);
+    std::vector<uint256_t> out;
+    for (std::size_t i = 0; i < n; i++) {
+        out.emplace_back(gen(), gen(), gen(), gen());
+    }
+    return out;
+}
+
+std::string read_file(const std::string & path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void write_file(const std::string & path, const std::string & bytes) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), bytes.size());
+}
+
+}
+
+TEST(Mmap, round_trip){
+    const std::string path = temp_path("round_trip");
+    const std::vector<uint256_t> in = values(1000);
+    {
+        uint256_mmap_writer out(path);
+        out.write(in[0]);
+        out.write(std::span<const uint256_t>(in).subspan(1));
+        EXPECT_EQ(out.size(), in.size());
+    }
+    EXPECT_EQ(std::filesystem::file_size(path), 64 + 32 * in.size());
+
+    const uint256_mmap_array array(path, true);
+    EXPECT_EQ(array.size(), in.size());
+    EXPECT_TRUE(array.has_checksum());
+    EXPECT_TRUE(array.verify());
+    ASSERT_TRUE(array.zero_copy());
+    const std::span<const uint256_t> mapped = array.values();
+    EXPECT_EQ(std::vector<uint256_t>(mapped.begin(), mapped.end()), in);
+    for (std::size_t i = 0; i < in.size(); i++) {
+        EXPECT_EQ(array[i], in[i]);
+    }
+    EXPECT_EQ(array.at(999), in[999]);
+    EXPECT_THROW((void)array.at(1000), std::out_of_range);
+    std::filesystem::remove(path);
+}
+
+TEST(Mmap, layout){
+    // header fields are little endian; host order values are the little endian images here
+    const std::string path = temp_path("layout");
+    {
+        uint256_mmap_writer out(path, false, uint256::byte_order::big);
+        out.write(uint256_t(1, 2, 3, 4));
+        out.write(0x0102_u256);
+    }
+    const std::string bytes = read_file(path);
+    ASSERT_EQ(bytes.size(), 128u);
+    EXPECT_EQ(bytes.substr(0, 8), "UINT256A");
+    EXPECT_EQ(bytes[8], 1);
+    EXPECT_EQ(bytes[9], 0);
+    EXPECT_EQ(bytes[10], 1);
+    EXPECT_EQ(bytes[11], 0);
+    EXPECT_EQ(bytes[12], 64);
+    EXPECT_EQ(bytes[16], 2);
+    EXPECT_EQ(bytes.substr(17, 47), std::string(47, '\0'));
+
+    // big endian: most significant limb first
+    EXPECT_EQ(bytes[64 + 7], 1);
+    EXPECT_EQ(bytes[64 + 31], 4);
+    EXPECT_EQ(bytes[96 + 30], 1);
+    EXPECT_EQ(bytes[96 + 31], 2);
+
+    const uint256_mmap_array array(path);
+    EXPECT_EQ(array.byte_order(), uint256::byte_order::big);
+    EXPECT_FALSE(array.has_checksum());
+    EXPECT_TRUE(array.verify());
+    EXPECT_EQ(array[0], uint256_t(1, 2, 3, 4));
+    EXPECT_EQ(array[1], 0x0102_u256);
+    if (!array.zero_copy()) {
+        EXPECT_THROW(array.values(), std::runtime_error);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(Mmap, foreign_order){
+    const std::string path = temp_path("foreign_order");
+    const std::vector<uint256_t> in = values(300);
+    for (const uint256::byte_order order : { uint256::byte_order::little, uint256::byte_order::big }) {
+        {
+            uint256_mmap_writer out(path, true, order);
+            out.write(in);
+        }
+        const uint256_mmap_array array(path, true);
+        EXPECT_EQ(array.byte_order(), order);
+        for (std::size_t i = 0; i < in.size(); i++) {
+            EXPECT_EQ(array[i], in[i]);
+        }
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(Mmap, empty){
+    const std::string path = temp_path("empty");
+    {
+        uint256_mmap_writer out(path);
+    }
+    const uint256_mmap_array array(path, true);
+    EXPECT_TRUE(array.empty());
+    EXPECT_TRUE(array.values().empty());
+    std::filesystem::remove(path);
+}
+
+TEST(Mmap, errors){
+    const std::string path = temp_path("errors");
+    EXPECT_THROW(uint256_mmap_array(temp_path("missing")), std::system_error);
+
+    write_file(path, "");
+    EXPECT_THROW(uint256_mmap_array{ path }, std::runtime_error);
+    write_file(path, std::string(64, 'x'));
+    EXPECT_THROW(uint256_mmap_array{ path }, std::runtime_error);
+
+    {
+        uint256_mmap_writer out(path);
+        out.write(values(10));
+    }
+    const std::string good = read_file(path);
+
+    // version, byte order and count checks
+    std::string bad = good;
+    bad[8] = 2;
+    write_file(path, bad);
+    EXPECT_THROW(uint256_mmap_array{ path }, std::runtime_error);
+    bad = good;
+    bad[10] = 7;
+    write_file(path, bad);
+    EXPECT_THROW(uint256_mmap_array{ path }, std::runtime_error);
+    write_file(path, good.substr(0, good.size() - 1));
+    EXPECT_THROW(uint256_mmap_array{ path }, std::runtime_error);
+
+    // a flipped data bit is caught by the checksum when verifying
+    bad = good;
+    bad[100] ^= 1;
+    write_file(path, bad);
+    EXPECT_NO_THROW(uint256_mmap_array{ path });
+    EXPECT_FALSE(uint256_mmap_array(path).verify());
+    EXPECT_THROW(uint256_mmap_array(path, true), std::runtime_error);
+
+    uint256_mmap_writer out(path);
+    out.close();
+    EXPECT_THROW(out.write(uint256_1), std::logic_error);
+    std::filesystem::remove(path);
+}
+
+TEST(Mmap, move){
+    const std::string path = temp_path("move");
+    {
+        uint256_mmap_writer out(path);
+        out.write(values(5));
+    }
+    uint256_mmap_array a(path);
+    uint256_mmap_array b(std::move(a));
+    EXPECT_EQ(b.size(), 5u);
+    EXPECT_EQ(b[4], values(5)[4]);
+    a = std::move(b);
+    EXPECT_EQ(a[0], values(5)[0]);
+    std::filesystem::remove(path);
+}
@@ -17,6 +17,16 @@ TEST(Arithmetic, modulo){
     EXPECT_THROW(uint256_t(1) % uint256_t(0), std::domain_error);
 }
 
+TEST(Arithmetic, modulo_multi_limb){
+    const uint256_t val(0xfedcba9876543210ULL, 0x0123456789abcdefULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL);
+
+    EXPECT_EQ(val % uint256_t(0x0000000000000000ULL, 0x1122334455667788ULL, 0x99aabbccddeeff00ULL, 0xffeeddccbbaa9988ULL),
+              uint256_t(0x0000000000000000ULL, 0x0235689bcf024537ULL, 0x96724e2a05e1beb0ULL, 0x87a7c7e808284868ULL));
+    EXPECT_EQ(val % uint256_t(0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffffffeULL, 0xffffffffffffffffULL),
+              uint256_t(0x0000000000000000ULL, 0x0000000000000000ULL, 0x0dfae7d4c1ae9b8aULL, 0x8796a5b4c3d2e1f1ULL));
+    EXPECT_EQ(val % uint256_t(0x89abcdefULL), uint256_t(0x000000000305e581ULL));
+}
+
 TEST(External, modulo){
     bool      t    = true;
     bool      f    = false;
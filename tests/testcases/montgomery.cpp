@@ -0,0 +1,110 @@
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "uint256_montgomery.h"
+
+// double-and-add reference that never needs more than 257 bits
+static uint256_t reference_mulmod(uint256_t a, const uint256_t & b, const uint256_t & p) {
+    const auto addmod = [&p](const uint256_t & x, const uint256_t & y) {
+        const uint256_t s = x + y;
+        return ((s < x) || (s >= p)) ? (s - p) : s;
+    };
+    a %= p;
+    uint256_t r = 0;
+    for (int i = 255; i >= 0; i--) {
+        r = addmod(r, r);
+        if (((b >> i) & 1) == 1) {
+            r = addmod(r, a);
+        }
+    }
+    return r;
+}
+
+static uint256_t reference_powmod(const uint256_t & base, const uint256_t & exp, const uint256_t & p) {
+    uint256_t r = 1 % p;
+    for (int i = 255; i >= 0; i--) {
+        r = reference_mulmod(r, r, p);
+        if (((exp >> i) & 1) == 1) {
+            r = reference_mulmod(r, base, p);
+        }
+    }
+    return r;
+}
+
+static const uint256_t secp256k1_p = 0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_u256;
+
+TEST(Montgomery, mulmod){
+    std::mt19937_64 gen(5);
+    for (int round = 0; round < 50; round++) {
+        uint256_t p(gen(), gen(), gen(), gen() | 1);
+        p >>= (unsigned int)(gen() % 250);
+        p |= 1;
+        if (p == 1) {
+            p = 3;
+        }
+        const montgomery_context<uint256_t> ctx(p);
+        for (int i = 0; i < 20; i++) {
+            const uint256_t a(gen(), gen(), gen(), gen()), b(gen(), gen(), gen(), gen());
+            ASSERT_EQ(ctx.mulmod(a, b), reference_mulmod(a, b, p)) << p;
+            const uint256_t ra = a % p, rb = b % p;
+            EXPECT_EQ(ctx.addmod(ra, rb), (ra + rb < ra) ? (ra + rb - p) : (ra + rb) % p);
+            EXPECT_EQ(ctx.addmod(ctx.submod(ra, rb), rb), ra);
+            EXPECT_EQ(ctx.from_montgomery(ctx.to_montgomery(a)), ra);
+        }
+    }
+
+    // modulus near 2^256 exercises the top carry of the reduction
+    const montgomery_context<uint256_t> top(uint256_max);
+    EXPECT_EQ(top.mulmod(uint256_max - 1, uint256_max - 1), 1);
+    EXPECT_EQ(top.mulmod(uint256_max - 1, 2), uint256_max - 2);
+}
+
+TEST(Montgomery, powmod){
+    const montgomery_context<uint256_t> field(secp256k1_p);
+    std::mt19937_64 gen(6);
+    for (int i = 0; i < 10; i++) {
+        const uint256_t a(gen(), gen(), gen(), gen());
+        const uint256_t e(gen(), gen(), 0, gen() % 1000);
+        EXPECT_EQ(field.powmod(a, e), reference_powmod(a, e, secp256k1_p));
+        // Fermat
+        if (a % secp256k1_p != 0) {
+            EXPECT_EQ(field.powmod(a, secp256k1_p - 1), 1);
+        }
+    }
+    EXPECT_EQ(field.powmod(12345, 0), 1);
+    EXPECT_EQ(field.powmod(0, 5), 0);
+    EXPECT_EQ(field.powmod(2, 255), uint256_1 << 255);
+    EXPECT_EQ(field.powmod(2, 256), (uint256_1 << 32) + 977);
+}
+
+TEST(Montgomery, inverse){
+    const montgomery_context<uint256_t> field(secp256k1_p);
+    std::mt19937_64 gen(7);
+    for (int i = 0; i < 50; i++) {
+        const uint256_t a = uint256_t(gen(), gen(), gen(), gen()) % secp256k1_p;
+        if (a == 0) {
+            continue;
+        }
+        EXPECT_EQ(field.mulmod(a, field.inverse(a)), 1);
+    }
+
+    // composite modulus: only units are invertible
+    const montgomery_context<uint256_t> composite(15);
+    EXPECT_EQ(composite.inverse(7), 13);
+    EXPECT_THROW((void)composite.inverse(5), std::domain_error);
+    EXPECT_THROW((void)composite.inverse(0), std::domain_error);
+}
+
+TEST(Montgomery, errors){
+    EXPECT_THROW(montgomery_context<uint256_t>{ uint256_t(10) }, std::domain_error);
+    EXPECT_THROW(montgomery_context<uint256_t>{ uint256_1 }, std::domain_error);
+    EXPECT_THROW(montgomery_context<uint256_t>{ uint256_0 }, std::domain_error);
+}
+
+TEST(Montgomery, compile_time){
+    constexpr montgomery_context<uint256_t> field(0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_u256);
+    static_assert(field.mulmod(2, field.inverse(2)) == 1);
+    static_assert(field.powmod(3, field.modulus() - 1) == 1);
+    static_assert(field.submod(0, 1) == field.modulus() - 1);
+}
@@ -0,0 +1,90 @@
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+// 32-bit limb schoolbook reference, least significant first
+static std::vector<uint64_t> reference_product(const uint256_t & a, const uint256_t & b) {
+    uint32_t x[8], y[8];
+    for (int i = 0; i < 8; i++) {
+        x[i] = (uint32_t)(uint64_t)(a >> (32 * i));
+        y[i] = (uint32_t)(uint64_t)(b >> (32 * i));
+    }
+    uint64_t r[16] = {};
+    for (int i = 0; i < 8; i++) {
+        uint64_t carry = 0;
+        for (int j = 0; j < 8; j++) {
+            const uint64_t t = (uint64_t)x[j] * y[i] + (uint32_t)r[i + j] + carry;
+            r[i + j] = (uint32_t)t;
+            carry = t >> 32;
+        }
+        r[i + 8] = carry;
+    }
+    std::vector<uint64_t> out(8);
+    for (int i = 0; i < 8; i++) {
+        out[i] = r[2 * i] | (r[2 * i + 1] << 32);
+    }
+    return out;
+}
+
+static std::vector<uint64_t> limbs(const std::pair <uint256_t, uint256_t> & hl) {
+    return { hl.second.lower().lower(), hl.second.lower().upper(), hl.second.upper().lower(), hl.second.upper().upper(),
+             hl.first.lower().lower(), hl.first.lower().upper(), hl.first.upper().lower(), hl.first.upper().upper() };
+}
+
+TEST(MulWide, random){
+    std::mt19937_64 gen(8);
+    for (int i = 0; i < 1000; i++) {
+        uint256_t a(gen(), gen(), gen(), gen()), b(gen(), gen(), gen(), gen());
+        a >>= (unsigned int)(gen() % 256);
+        b >>= (unsigned int)(gen() % 256);
+        const std::pair <uint256_t, uint256_t> p = mul_wide(a, b);
+        EXPECT_EQ(p.second, a * b);
+        EXPECT_EQ(limbs(p), reference_product(a, b));
+    }
+}
+
+TEST(MulWide, edges){
+    const std::pair <uint256_t, uint256_t> p = mul_wide(uint256_max, uint256_max);
+    EXPECT_EQ(p.first, uint256_max - 1);
+    EXPECT_EQ(p.second, 1);
+    EXPECT_EQ(mul_wide(uint256_1 << 255, 2).first, 1);
+    EXPECT_EQ(mul_wide(uint256_1 << 255, 2).second, 0);
+    static_assert(mul_wide(uint256_1 << 128, uint256_1 << 128).first == 1);
+}
+
+TEST(MulDiv, random){
+    std::mt19937_64 gen(9);
+    for (int i = 0; i < 1000; i++) {
+        uint256_t a(gen(), gen(), gen(), gen()), b(gen(), gen(), gen(), gen()), c(gen(), gen(), gen(), gen());
+        a >>= (unsigned int)(gen() % 256);
+        b >>= (unsigned int)(gen() % 256);
+        c >>= (unsigned int)(gen() % 256);
+        if (!c || (mul_wide(a, b).first >= c)) {
+            continue;
+        }
+        const uint256_t q = muldiv(a, b, c);
+
+        // a * b - q * c must be in [0, c)
+        const std::pair <uint256_t, uint256_t> ab = mul_wide(a, b), qc = mul_wide(q, c);
+        const uint256_t lo = ab.second - qc.second;
+        const uint256_t hi = ab.first - qc.first - (ab.second < qc.second ? 1 : 0);
+        EXPECT_EQ(hi, 0) << a << " " << b << " " << c;
+        EXPECT_LT(lo, c) << a << " " << b << " " << c;
+    }
+}
+
+TEST(MulDiv, known_values){
+    // pro-rata share without intermediate overflow
+    const uint256_t total = uint256_1 << 200;
+    EXPECT_EQ(muldiv(total, 3, 4), (uint256_1 << 198) * 3);
+    EXPECT_EQ(muldiv(uint256_max, uint256_max, uint256_max), uint256_max);
+    EXPECT_EQ(muldiv(uint256_max, 7, 13), 0x89d89d89d89d89d89d89d89d89d89d89d89d89d89d89d89d89d89d89d89d89d8_u256);
+    EXPECT_EQ(muldiv(1ULL << 63, 1ULL << 63, 1ULL << 62), uint256_1 << 64);
+    static_assert(muldiv(uint256_1 << 255, 4, 8) == uint256_1 << 254);
+
+    EXPECT_THROW((void)muldiv(1, 1, 0), std::domain_error);
+    EXPECT_THROW((void)muldiv(uint256_max, 2, 1), std::overflow_error);
+    EXPECT_THROW((void)muldiv(uint256_1 << 128, uint256_1 << 128, 1), std::overflow_error);
+}
@@ -16,6 +16,31 @@ TEST(Arithmetic, multiply){
     EXPECT_EQ(one * val, val);
 }
 
+TEST(Arithmetic, multiply_full_width){
+    const uint256_t a(0xfedcba9876543210ULL, 0x0123456789abcdefULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL);
+    const uint256_t b(0x1122334455667788ULL, 0x99aabbccddeeff00ULL, 0xffeeddccbbaa9988ULL, 0x7766554433221100ULL);
+
+    EXPECT_EQ(a * b, uint256_t(0xfef8989abab44323ULL, 0x1110655421106777ULL, 0x787a7d81868c939bULL, 0xa4aeb9c5d2e0f000ULL));
+    EXPECT_EQ(a * b, b * a);
+
+    // carries out of every limb
+    const uint256_t lower_max(0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL);
+    EXPECT_EQ(lower_max * lower_max, uint256_t(0xffffffffffffffffULL, 0xfffffffffffffffeULL, 0x0000000000000000ULL, 0x0000000000000001ULL));
+    EXPECT_EQ(uint256_max * uint256_max, 1);
+}
+
+TEST(Arithmetic, multiply_narrow){
+    // single limb operands take a short path; the product still fills two limbs
+    const uint256_t a(0xffffffffffffffffULL), b(0xfedcba9876543210ULL);
+    EXPECT_EQ(a * a, uint256_t(0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffffffeULL, 0x0000000000000001ULL));
+    EXPECT_EQ(a * b, uint256_t(0x0000000000000000ULL, 0x0000000000000000ULL, 0xfedcba987654320fULL, 0x0123456789abcdf0ULL));
+    EXPECT_EQ(uint256_t(3) * uint256_t(5), 15);
+
+    // a second limb in either operand leaves the short path
+    EXPECT_EQ(a * (b << 64), (a * b) << 64);
+    EXPECT_EQ((a << 64) * b, (a * b) << 64);
+}
+
 TEST(External, multiply){
     bool      t    = true;
     bool      f    = false;
@@ -0,0 +1,65 @@
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+TEST(Overflow, add){
+    EXPECT_EQ(add_overflow(1, 2), std::make_pair(uint256_t(3), false));
+    EXPECT_EQ(add_overflow(uint256_max, 1), std::make_pair(uint256_0, true));
+    EXPECT_EQ(add_overflow(uint256_max, uint256_max), std::make_pair(uint256_max - 1, true));
+    // carry out of the low half alone
+    EXPECT_EQ(add_overflow(uint256_t(0, uint128_t(-1)), 1), std::make_pair(uint256_1 << 128, false));
+    // carry out of the low half into an all-ones upper half
+    EXPECT_EQ(add_overflow(uint256_max, uint256_t(0, uint128_t(1))), std::make_pair(uint256_0, true));
+    EXPECT_EQ(add_overflow(uint256_t(uint128_t(-1), uint128_t(0)), uint256_t(0, uint128_t(-1))), std::make_pair(uint256_max, false));
+    static_assert(add_overflow(uint256_max, 2).second);
+}
+
+TEST(Overflow, sub){
+    EXPECT_EQ(sub_overflow(3, 2), std::make_pair(uint256_1, false));
+    EXPECT_EQ(sub_overflow(0, 1), std::make_pair(uint256_max, true));
+    EXPECT_EQ(sub_overflow(uint256_1 << 128, 1), std::make_pair(uint256_t(0, uint128_t(-1)), false));
+    // equal upper halves with a borrow from the low half
+    EXPECT_EQ(sub_overflow(uint256_t(5, 1), uint256_t(5, 2)), std::make_pair(uint256_max, true));
+    EXPECT_EQ(sub_overflow(uint256_max, uint256_max), std::make_pair(uint256_0, false));
+    static_assert(!sub_overflow(uint256_max, 1).second);
+}
+
+TEST(Overflow, mul){
+    EXPECT_EQ(mul_overflow(6, 7), std::make_pair(uint256_t(42), false));
+    EXPECT_EQ(mul_overflow(0, uint256_max), std::make_pair(uint256_0, false));
+    EXPECT_EQ(mul_overflow(uint256_1 << 128, uint256_1 << 127), std::make_pair(uint256_1 << 255, false));
+    EXPECT_EQ(mul_overflow(uint256_1 << 128, uint256_1 << 128), std::make_pair(uint256_0, true));
+    // 257 bit operands straddling the limit
+    EXPECT_EQ(mul_overflow(uint256_max, 1), std::make_pair(uint256_max, false));
+    EXPECT_EQ(mul_overflow(uint256_max, 2), std::make_pair(uint256_max - 1, true));
+    EXPECT_EQ(mul_overflow((uint256_1 << 128) + 1, uint256_1 << 128).second, true);
+    EXPECT_EQ(mul_overflow((uint256_1 << 128) + 1, (uint256_1 << 128) - 1).second, false);
+    static_assert(mul_overflow(uint256_max, uint256_max).second);
+}
+
+TEST(Overflow, random){
+    std::mt19937_64 gen(16);
+    for (int i = 0; i < 1000; i++) {
+        uint256_t a(gen(), gen(), gen(), gen()), b(gen(), gen(), gen(), gen());
+        a >>= (unsigned int)(gen() % 256);
+        b >>= (unsigned int)(gen() % 256);
+
+        EXPECT_EQ(add_overflow(a, b), std::make_pair(a + b, (a + b) < a));
+        EXPECT_EQ(sub_overflow(a, b), std::make_pair(a - b, b > a));
+        EXPECT_EQ(mul_overflow(a, b), std::make_pair(a * b, (bool) mul_wide(a, b).first));
+    }
+}
+
+TEST(Saturating, all){
+    EXPECT_EQ(add_sat(1, 2), 3);
+    EXPECT_EQ(add_sat(uint256_max, 1), uint256_max);
+    EXPECT_EQ(sub_sat(3, 2), 1);
+    EXPECT_EQ(sub_sat(2, 3), 0);
+    EXPECT_EQ(mul_sat(uint256_1 << 200, 4), uint256_1 << 202);
+    EXPECT_EQ(mul_sat(uint256_1 << 200, uint256_1 << 56), uint256_max);
+    static_assert(add_sat(uint256_max - 1, 1) == uint256_max);
+    static_assert(sub_sat(uint256_0, uint256_max) == uint256_0);
+    static_assert(mul_sat(uint256_max, uint256_max) == uint256_max);
+}
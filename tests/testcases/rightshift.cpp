@@ -25,6 +25,39 @@ TEST(BitShift, right){
     }
 }
 
+TEST(BitShift, right_across_limbs){
+    const uint256_t val(0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL);
+
+    EXPECT_EQ(val >> 0,   val);
+    EXPECT_EQ(val >> 4,   uint256_t(0x00123456789abcdeULL, 0xffedcba987654321ULL, 0x00f1e2d3c4b5a697ULL, 0x88796a5b4c3d2e1fULL));
+    EXPECT_EQ(val >> 64,  uint256_t(0x0000000000000000ULL, 0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL));
+    EXPECT_EQ(val >> 68,  uint256_t(0x0000000000000000ULL, 0x00123456789abcdeULL, 0xffedcba987654321ULL, 0x00f1e2d3c4b5a697ULL));
+    EXPECT_EQ(val >> 128, uint256_t(0x0000000000000000ULL, 0x0000000000000000ULL, 0x0123456789abcdefULL, 0xfedcba9876543210ULL));
+    EXPECT_EQ(val >> 196, uint256_t(0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00123456789abcdeULL));
+    EXPECT_EQ(uint256_max >> 255, 1);
+
+    // out of range counts clear the value
+    EXPECT_EQ(val >> 256,            0);
+    EXPECT_EQ(val >> 0x100000000ULL, 0);
+    EXPECT_EQ(val >> -1,             0);
+    EXPECT_EQ(val >> uint256_max,    0);
+
+    for(unsigned int i = 0; i < 256; i++){
+        EXPECT_EQ(val >> i, val / (uint256_1 << uint256_t(i)));
+    }
+}
+
+TEST(BitShift, right_compile_time){
+    const uint256_t val(0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL);
+
+    EXPECT_EQ(val.shr<0>(),   val);
+    EXPECT_EQ(val.shr<1>(),   val >> 1);
+    EXPECT_EQ(val.shr<64>(),  val >> 64);
+    EXPECT_EQ(val.shr<68>(),  val >> 68);
+    EXPECT_EQ(val.shr<128>(), val >> 128);
+    EXPECT_EQ(val.shr<255>(), val >> 255);
+}
+
 TEST(External, shift_right){
     bool     t   = true;
     bool     f   = false;
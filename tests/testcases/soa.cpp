@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <random>
+#include <ranges>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "uint256_soa.h"
+
+static_assert(std::ranges::random_access_range<uint256_soa>);
+static_assert(std::ranges::random_access_range<const uint256_soa>);
+static_assert(std::ranges::sized_range<uint256_soa>);
+static_assert(std::sortable<uint256_soa::iterator>);
+static_assert(std::indirectly_writable<uint256_soa::iterator, uint256_t>);
+
+static std::vector<uint256_t> values(const std::size_t n, const uint64_t seed) {
+    std::mt19937_64 gen(seed);
+    std::vector<uint256_t> out;
+    for (std::size_t i = 0; i < n; i++) {
+        out.emplace_back(gen() % 3 ? 0 : gen(), gen(), gen() % 2 ? ~0ULL : gen(), gen());
+    }
+    return out;
+}
+
+TEST(SoA, layout){
+    const std::vector<uint256_t> v = values(100, 1);
+    const uint256_soa soa(v);
+    ASSERT_EQ(soa.size(), v.size());
+    for (int k = 0; k < 4; k++) {
+        EXPECT_EQ((uintptr_t)soa.column(k).data() % uint256_soa::alignment, 0u);
+        EXPECT_EQ(soa.column(k).size(), v.size());
+    }
+    for (std::size_t i = 0; i < v.size(); i++) {
+        EXPECT_EQ(soa[i], v[i]);
+        EXPECT_EQ(soa.column(0)[i], v[i].lower().lower());
+        EXPECT_EQ(soa.column(3)[i], v[i].upper().upper());
+    }
+
+    std::vector<uint256_t> back(v.size());
+    soa.copy_to(back);
+    EXPECT_EQ(back, v);
+    std::vector<uint256_t> short_back(1);
+    EXPECT_THROW(soa.copy_to(short_back), std::invalid_argument);
+}
+
+TEST(SoA, proxy){
+    uint256_soa soa = { 1, 2, uint256_max };
+    soa[0] = uint256_1 << 200;
+    EXPECT_EQ(soa[0], uint256_1 << 200);
+    EXPECT_EQ(soa[0].limb(3), 1ULL << 8);
+
+    soa[1] = soa[2];
+    EXPECT_EQ(soa[1], uint256_max);
+    EXPECT_TRUE(soa[0] < soa[1]);
+    EXPECT_TRUE(soa[1] == uint256_max);
+    EXPECT_TRUE(uint256_max == soa[1]);
+    EXPECT_TRUE(uint256_1 < soa[0]);
+
+    swap(soa[0], soa[2]);
+    EXPECT_EQ(soa[0], uint256_max);
+    EXPECT_EQ(soa[2], uint256_1 << 200);
+
+    const uint256_t copied = soa.at(2);
+    EXPECT_EQ(copied, uint256_1 << 200);
+    EXPECT_THROW(soa.at(3), std::out_of_range);
+
+    soa.push_back(7);
+    EXPECT_EQ(soa.size(), 4u);
+    soa.pop_back();
+    soa.resize(5);
+    EXPECT_EQ(soa[4], 0);
+}
+
+TEST(SoA, ranges){
+    const std::vector<uint256_t> v = values(500, 2);
+    uint256_soa soa(v);
+
+    std::ranges::sort(soa);
+    std::vector<uint256_t> expected = v;
+    std::sort(expected.begin(), expected.end());
+    EXPECT_TRUE(std::ranges::equal(soa, expected));
+    EXPECT_TRUE(std::ranges::is_sorted(std::as_const(soa)));
+
+    const auto big = std::ranges::count_if(soa, [](const uint256_t & x) { return x > (uint256_1 << 192); });
+    EXPECT_EQ((std::size_t)big, (std::size_t)std::ranges::count_if(v, [](const uint256_t & x) { return x > (uint256_1 << 192); }));
+
+    const std::size_t small = std::ranges::count_if(v, [](const uint256_t & x) { return !x.upper(); });
+    EXPECT_EQ(uint256::count_fits_128(soa), small);
+}
+
+TEST(SoA, arithmetic){
+    const std::vector<uint256_t> a = values(257, 3), b = values(257, 4);
+    const uint256_soa sa(a), sb(b);
+    uint256_soa out;
+
+    uint256::add(sa, sb, out);
+    for (std::size_t i = 0; i < a.size(); i++) {
+        ASSERT_EQ(out[i], a[i] + b[i]) << i;
+    }
+    uint256::sub(sa, sb, out);
+    for (std::size_t i = 0; i < a.size(); i++) {
+        ASSERT_EQ(out[i], a[i] - b[i]) << i;
+    }
+
+    // carry and borrow through every limb
+    const uint256_soa ones = { uint256_max, 0 }, one = { 1, 1 };
+    uint256::add(ones, one, out);
+    EXPECT_EQ(out[0], 0);
+    uint256::sub(ones, one, out);
+    EXPECT_EQ(out[1], uint256_max);
+
+    const uint256_soa shorter = { 1 };
+    EXPECT_THROW(uint256::add(sa, shorter, out), std::invalid_argument);
+}
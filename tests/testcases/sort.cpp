@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "uint256_sort.h"
+
+namespace {
+
+std::vector<uint256_t> random_keys(const std::size_t n, const uint64_t seed) {
+    std::mt19937_64 gen(seed);
+    std::vector<uint256_t> keys;
+    keys.reserve(n);
+    for (std::size_t i = 0; i < n; i++) {
+        keys.emplace_back(gen(), gen(), gen(), gen());
+    }
+    return keys;
+}
+
+// few distinct values; most keys share the upper bytes
+std::vector<uint256_t> skewed_keys(const std::size_t n, const uint64_t seed) {
+    std::mt19937_64 gen(seed);
+    std::vector<uint256_t> keys;
+    keys.reserve(n);
+    for (std::size_t i = 0; i < n; i++) {
+        const uint64_t r = gen();
+        switch (r % 4) {
+            case 0:
+                keys.emplace_back(gen() % 1000);
+                break;
+            case 1:
+                keys.emplace_back(uint256_max - (gen() % 16));
+                break;
+            case 2:
+                keys.emplace_back(0x1234, 0, gen() % 3, gen());
+                break;
+            default:
+                keys.emplace_back(uint256_1 << (unsigned int)(gen() % 256));
+                break;
+        }
+    }
+    return keys;
+}
+
+void expect_sorted_like_std(std::vector<uint256_t> keys, const unsigned int threads) {
+    std::vector<uint256_t> expected = keys;
+    std::sort(expected.begin(), expected.end());
+    if (threads) {
+        uint256::parallel_sort(keys, threads);
+    } else {
+        uint256::sort(keys);
+    }
+    EXPECT_EQ(keys, expected);
+}
+
+}
+
+TEST(Sort, small){
+    std::vector<uint256_t> empty;
+    uint256::sort(empty);
+    EXPECT_TRUE(empty.empty());
+
+    std::vector<uint256_t> one = { 5 };
+    uint256::sort(one);
+    EXPECT_EQ(one, std::vector<uint256_t>({ 5 }));
+
+    std::vector<uint256_t> equal(100, uint256_t(7, 0));
+    uint256::sort(equal);
+    EXPECT_EQ(equal, std::vector<uint256_t>(100, uint256_t(7, 0)));
+
+    for (std::size_t n : { 2, 3, 63, 64, 65, 257, 1000 }) {
+        expect_sorted_like_std(random_keys(n, n), 0);
+    }
+}
+
+TEST(Sort, random){
+    expect_sorted_like_std(random_keys(100000, 1), 0);
+}
+
+TEST(Sort, skewed){
+    expect_sorted_like_std(skewed_keys(100000, 2), 0);
+
+    // keys that only differ in the lowest byte
+    std::vector<uint256_t> low = random_keys(5000, 3);
+    for (uint256_t & key : low) {
+        key = (uint256_max << 8) | (key & 0xff);
+    }
+    expect_sorted_like_std(low, 0);
+}
+
+TEST(Sort, parallel){
+    for (const unsigned int threads : { 1, 2, 3, 8 }) {
+        expect_sorted_like_std(random_keys(200000, 4), threads);
+        expect_sorted_like_std(skewed_keys(200000, 5), threads);
+    }
+    // below the parallel cutoff
+    expect_sorted_like_std(random_keys(1000, 6), 4);
+
+    std::vector<uint256_t> equal(100000, uint256_max);
+    uint256::parallel_sort(equal, 4);
+    EXPECT_EQ(equal, std::vector<uint256_t>(100000, uint256_max));
+}
+
+TEST(Sort, unique){
+    for (const unsigned int threads : { 0, 4 }) {
+        std::vector<uint256_t> keys = skewed_keys(150000, 7);
+        std::vector<uint256_t> expected = keys;
+        std::sort(expected.begin(), expected.end());
+        expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+        const std::span<uint256_t> unique = threads ? uint256::parallel_sort_unique(keys, threads) : uint256::sort_unique(keys);
+        EXPECT_EQ(unique.data(), keys.data());
+        EXPECT_EQ(std::vector<uint256_t>(unique.begin(), unique.end()), expected);
+    }
+
+    std::vector<uint256_t> none;
+    EXPECT_TRUE(uint256::sort_unique(none).empty());
+}
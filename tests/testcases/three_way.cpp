@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <compare>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+TEST(Comparison, three_way){
+    const uint256_t values[] = {
+        0, 1, uint64_t(-1), uint256_1 << 64, uint256_t(1, 0, 0, 0), uint256_t(1, 0, 0, 1), uint256_max - 1, uint256_max,
+    };
+    for (std::size_t i = 0; i < std::size(values); i++) {
+        for (std::size_t j = 0; j < std::size(values); j++) {
+            EXPECT_EQ(values[i] <=> values[j], i <=> j);
+            EXPECT_EQ(values[i] == values[j], i == j);
+            EXPECT_EQ(values[i] != values[j], i != j);
+            EXPECT_EQ(values[i] < values[j], i < j);
+            EXPECT_EQ(values[i] <= values[j], i <= j);
+            EXPECT_EQ(values[i] > values[j], i > j);
+            EXPECT_EQ(values[i] >= values[j], i >= j);
+        }
+    }
+    static_assert((uint256_1 <=> uint256_max) == std::strong_ordering::less);
+    static_assert(std::three_way_comparable<uint256_t>);
+}
+
+TEST(Comparison, random_halves){
+    // values that only differ in one limb exercise every step of the borrow chain
+    std::mt19937_64 gen(19);
+    for (int i = 0; i < 1000; i++) {
+        uint64_t a[4] = { gen(), gen(), gen(), gen() };
+        uint64_t b[4] = { a[0], a[1], a[2], a[3] };
+        const int k = (int)(gen() % 4);
+        b[k] = gen();
+        const uint256_t x(a[3], a[2], a[1], a[0]), y(b[3], b[2], b[1], b[0]);
+        EXPECT_EQ(x <=> y, a[k] <=> b[k]);
+        EXPECT_EQ(x < y, a[k] < b[k]);
+        EXPECT_EQ(x > y, a[k] > b[k]);
+    }
+}
+
+TEST(Comparison, mixed_operands){
+    const uint256_t big = uint256_1 << 200;
+    EXPECT_TRUE(big > 5);
+    EXPECT_TRUE(5 < big);
+    EXPECT_TRUE(5 != big);
+    EXPECT_FALSE(5 == big);
+    EXPECT_EQ(5 <=> big, std::strong_ordering::less);
+    EXPECT_EQ(big <=> uint128_t(5), std::strong_ordering::greater);
+    EXPECT_EQ(uint128_t(5) <=> big, std::strong_ordering::less);
+    EXPECT_TRUE(uint128_t(5) < big);
+    EXPECT_FALSE(uint128_t(0) == (uint256_1 << 128));
+
+    // uint128_t operands are compared limb by limb
+    const uint128_t half(0x0123456789abcdefULL, 0xfedcba9876543210ULL);
+    EXPECT_TRUE(uint256_t(half) == half);
+    EXPECT_FALSE((uint256_t(half) | (uint256_1 << 255)) == half);
+    EXPECT_EQ(uint256_t(half) <=> half, std::strong_ordering::equal);
+    EXPECT_EQ((uint256_t(half) + 1) <=> half, std::strong_ordering::greater);
+    EXPECT_EQ((uint256_t(half) - (uint256_1 << 64)) <=> half, std::strong_ordering::less);
+    EXPECT_EQ((uint256_1 << 192) <=> half, std::strong_ordering::greater);
+
+    // integral operands compare as if converted to uint256_t
+    EXPECT_TRUE(uint256_max == -1);
+    EXPECT_TRUE(-1 == uint256_max);
+    EXPECT_TRUE(uint256_0 < -1);
+    EXPECT_TRUE(uint256_t(-1) == -1);
+}
+
+TEST(Comparison, sort){
+    std::mt19937_64 gen(20);
+    std::vector<uint256_t> v;
+    for (int i = 0; i < 1000; i++) {
+        v.emplace_back(gen() % 4, gen(), gen() % 2, gen());
+    }
+    std::sort(v.begin(), v.end());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end(), [](const uint256_t & a, const uint256_t & b) {
+        return (a.upper() < b.upper()) || ((a.upper() == b.upper()) && (a.lower() < b.lower()));
+    }));
+    std::ranges::sort(v, std::ranges::greater{});
+    EXPECT_TRUE(std::ranges::is_sorted(v, std::ranges::greater{}));
+}
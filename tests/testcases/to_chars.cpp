@@ -0,0 +1,82 @@
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+// digit at a time reference conversion
+static std::string reference(uint256_t value, const uint64_t base) {
+    std::string out;
+    do {
+        const std::pair <uint256_t, uint64_t> qr = uint256_t::divmod(value, base);
+        out.insert(out.begin(), "0123456789abcdefghijklmnopqrstuvwxyz"[qr.second]);
+        value = qr.first;
+    } while (value);
+    return out;
+}
+
+TEST(ToChars, known_values){
+    char buf[256];
+
+    std::to_chars_result res = to_chars(buf, buf + sizeof(buf), uint256_max);
+    EXPECT_EQ(res.ec, std::errc{});
+    EXPECT_EQ(std::string(buf, res.ptr), "115792089237316195423570985008687907853269984665640564039457584007913129639935");
+
+    res = to_chars(buf, buf + sizeof(buf), uint256_max, 16);
+    EXPECT_EQ(std::string(buf, res.ptr), std::string(64, 'f'));
+
+    res = to_chars(buf, buf + sizeof(buf), uint256_max, 2);
+    EXPECT_EQ(std::string(buf, res.ptr), std::string(256, '1'));
+
+    res = to_chars(buf, buf + sizeof(buf), uint256_0, 10);
+    EXPECT_EQ(std::string(buf, res.ptr), "0");
+
+    // chunk boundary: 10^19 needs a zero padded low chunk
+    res = to_chars(buf, buf + sizeof(buf), uint256_t(10000000000000000000ULL), 10);
+    EXPECT_EQ(std::string(buf, res.ptr), "10000000000000000000");
+
+    // eight digit groups inside one chunk
+    for (const uint64_t v : { 99999999ULL, 100000000ULL, 100000001ULL, 9999999999999999ULL, 10000000000000000ULL, 9999999999999999999ULL, 18446744073709551615ULL }) {
+        res = to_chars(buf, buf + sizeof(buf), uint256_t(v), 10);
+        EXPECT_EQ(std::string(buf, res.ptr), std::to_string(v));
+    }
+}
+
+TEST(ToChars, all_bases){
+    std::mt19937_64 gen(42);
+    for (int i = 0; i < 200; i++) {
+        uint256_t value(gen(), gen(), gen(), gen());
+        value >>= (unsigned int)(gen() % 256);
+        for (int base = 2; base <= 36; base++) {
+            char buf[256];
+            const std::to_chars_result res = to_chars(buf, buf + sizeof(buf), value, base);
+            ASSERT_EQ(res.ec, std::errc{});
+            EXPECT_EQ(std::string(buf, res.ptr), reference(value, base)) << "base " << base;
+        }
+    }
+}
+
+TEST(ToChars, errors){
+    char buf[78];
+
+    // exactly enough room
+    std::to_chars_result res = to_chars(buf, buf + 78, uint256_max);
+    EXPECT_EQ(res.ec, std::errc{});
+    EXPECT_EQ(res.ptr, buf + 78);
+
+    res = to_chars(buf, buf + 77, uint256_max);
+    EXPECT_EQ(res.ec, std::errc::value_too_large);
+    EXPECT_EQ(res.ptr, buf + 77);
+
+    res = to_chars(buf, buf + 78, uint256_1, 1);
+    EXPECT_EQ(res.ec, std::errc::invalid_argument);
+    res = to_chars(buf, buf + 78, uint256_1, 37);
+    EXPECT_EQ(res.ec, std::errc::invalid_argument);
+}
+
+TEST(ToChars, compile_time){
+    static_assert(uint256_t(1234567890123456789ULL).str(10) == "1234567890123456789");
+    static_assert((uint256_1 << 255).str(8).size() == 86);
+    static_assert(uint256_max.str(10).size() == 78);
+}
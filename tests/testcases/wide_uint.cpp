@@ -0,0 +1,124 @@
+#include <random>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "wide_uint.h"
+
+static uint256_t random_uint256(std::mt19937_64 & gen) {
+    uint256_t x(gen(), gen(), gen(), gen());
+    return x >> (unsigned int)(gen() % 256);
+}
+
+static uint512_t random_uint512(std::mt19937_64 & gen) {
+    uint512_t x(random_uint256(gen), random_uint256(gen));
+    return x >> (gen() % 512);
+}
+
+TEST(WideUint, construction){
+    static_assert(sizeof(uint512_t) == 64);
+    static_assert(sizeof(uint1024_t) == 128);
+    static_assert(uint512_t().bits() == 0);
+    static_assert(uint512_t(5).limbs()[0] == 5);
+    static_assert(uint512_t(-1) == ~uint512_t(0));
+    static_assert(uint512_t(uint128_t(1, 2)).limbs()[1] == 1);
+
+    const uint256_t a(1, 2, 3, 4);
+    const uint512_t w = a;
+    EXPECT_EQ(w.limbs()[0], 4);
+    EXPECT_EQ(w.limbs()[3], 1);
+    EXPECT_EQ(w.limbs()[4], 0);
+    EXPECT_EQ(uint256_t(w), a);
+
+    // narrowing is explicit and keeps the low limbs
+    const uint1024_t big = uint1024_t(1) << 700 | uint1024_t(w);
+    EXPECT_EQ(uint512_t(big), w);
+    EXPECT_EQ(uint1024_t(uint512_t(big)), uint1024_t(w));
+    static_assert(!std::is_convertible_v<uint1024_t, uint512_t>);
+    static_assert(std::is_convertible_v<uint512_t, uint1024_t>);
+}
+
+TEST(WideUint, matches_uint256){
+    // everything below 2^256 must agree with uint256_t
+    std::mt19937_64 gen(21);
+    for (int i = 0; i < 500; i++) {
+        const uint256_t a = random_uint256(gen), b = random_uint256(gen) | 1;
+        const unsigned int s = (unsigned int)(gen() % 256);
+
+        EXPECT_EQ(uint256_t(uint512_t(a) + b), a + b);
+        EXPECT_EQ(uint256_t(uint512_t(a) - b), a - b);
+        EXPECT_EQ(uint256_t(uint512_t(a) * b), a * b);
+        EXPECT_EQ(uint256_t(uint512_t(a) / b), a / b);
+        EXPECT_EQ(uint256_t(uint512_t(a) % b), a % b);
+        EXPECT_EQ(uint256_t(uint512_t(a) & b), a & b);
+        EXPECT_EQ(uint256_t(uint512_t(a) | b), a | b);
+        EXPECT_EQ(uint256_t(uint512_t(a) ^ b), a ^ b);
+        EXPECT_EQ(uint256_t(uint512_t(a) >> s), a >> s);
+        EXPECT_EQ(uint256_t(uint512_t(a) << s), a << s);
+        EXPECT_EQ(uint512_t(a) <=> uint512_t(b), a <=> b);
+        EXPECT_EQ(uint512_t(a).bits(), a.bits());
+        EXPECT_EQ(uint512_t(a).str(), a.str());
+        EXPECT_EQ(uint512_t(a).str(16), a.str(16));
+    }
+}
+
+TEST(WideUint, widening_product){
+    std::mt19937_64 gen(22);
+    for (int i = 0; i < 500; i++) {
+        const uint256_t a = random_uint256(gen), b = random_uint256(gen);
+        const std::pair <uint256_t, uint256_t> p = mul_wide(a, b);
+        EXPECT_EQ(uint512_t(a) * b, uint512_t(p.first, p.second));
+        EXPECT_EQ(mul_wide(uint512_t(a), uint512_t(b)), uint1024_t(uint512_t(p.first, p.second)));
+    }
+    static_assert(uint512_t(uint256_max) * uint256_max == uint512_t(uint256_max - 1, uint256_1));
+}
+
+TEST(WideUint, division){
+    std::mt19937_64 gen(23);
+    for (int i = 0; i < 500; i++) {
+        const uint512_t n = random_uint512(gen), d = random_uint512(gen) | 1;
+        const std::pair <uint512_t, uint512_t> qr = uint512_t::divmod(n, d);
+        EXPECT_LT(qr.second, d);
+        EXPECT_EQ(qr.first * d + qr.second, n);
+        // and without overflow in the check
+        EXPECT_EQ(mul_wide(qr.first, d) + uint1024_t(qr.second), uint1024_t(n));
+    }
+    EXPECT_THROW(uint512_t::divmod(1, 0), std::domain_error);
+
+    const uint512_t max = ~uint512_t(0);
+    const uint512_t d(10000000000000000000000000000000000000007_u256);
+    EXPECT_EQ((max / d).str(), "1340780792994259709957402499820584612746998035504143355975385962622301993778431799055334529467507572595167574423003");
+    EXPECT_EQ((max % d).str(), "7028260366541105674016938267475985123074");
+}
+
+TEST(WideUint, shifts_and_strings){
+    EXPECT_EQ((uint512_t(1) << 511).str(), "6703903964971298549787012499102923063739682910296196688861780721860882015036773488400937149083451713845015929093243025426876941405973284973216824503042048");
+    EXPECT_EQ((uint512_t(1) << 511).str(16), "8" + std::string(127, '0'));
+    EXPECT_EQ(uint512_t(1) << 512, 0);
+    EXPECT_EQ(uint512_t(1) << -1, 0);
+    EXPECT_EQ((uint512_t(1) << 300) >> 299, 2);
+    EXPECT_EQ(uint512_t(0).str(), "0");
+    EXPECT_EQ(uint512_t(255).str(2, 10), "0011111111");
+
+    // 3^300 mod 2^1024
+    uint1024_t p = 1;
+    for (int i = 0; i < 300; i++) {
+        p *= 3;
+    }
+    std::stringstream s;
+    s << std::hex << p;
+    EXPECT_EQ(s.str(), "b39cfff485a5dbf4d6aae030b91bfb0ec6bba389cd8d7f85bba3985c19c5e24e40c543a123c6e028a873e9e3874e1b4623a44be39b34e67dc5c2671");
+}
+
+TEST(WideUint, increment){
+    uint512_t x = uint256_max;
+    ++x;
+    EXPECT_EQ(x, uint512_t(1) << 256);
+    x--;
+    EXPECT_EQ(x, uint512_t(uint256_max));
+    EXPECT_EQ(-uint512_t(1), ~uint512_t(0));
+    EXPECT_EQ(uint512_t(0) - 1, ~uint512_t(0));
+    x += 1;
+    x <<= 1;
+    EXPECT_EQ(x, uint512_t(1) << 257);
+}